@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(BENCH_HPP)
+#define BENCH_HPP
+
+#include <time.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace bench {
+
+// 마이크로초 단위 monotonic clock. (ns 해상도라 짧은 구간도 잴 수 있다)
+inline double now_us() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (ts.tv_sec * 1e6 + ts.tv_nsec / 1e3);
+}
+
+class timer {
+ private:
+  double _start;
+
+ public:
+  timer() : _start(now_us()) {}
+
+  void reset() { this->_start = now_us(); }
+
+  // reset 이후 경과 시간 / ops 를 ns 단위로 리턴.
+  double ns_per_op(size_t ops) const {
+    if (ops == 0) {
+      return (0);
+    }
+    return ((now_us() - this->_start) * 1e3 / ops);
+  }
+};
+
+// xorshift. rand()보다 범위가 넓고 플랫폼마다 결과가 같다.
+class xorshift {
+ private:
+  unsigned long _state;
+
+ public:
+  explicit xorshift(unsigned long seed = 88172645463325252UL) : _state(seed) {}
+
+  unsigned long next() {
+    this->_state ^= this->_state << 13;
+    this->_state ^= this->_state >> 7;
+    this->_state ^= this->_state << 17;
+    return (this->_state);
+  }
+};
+
+// 첫번째 인자로 측정할 최대 크기를 받는다. (없으면 def)
+inline size_t max_size_arg(int argc, char** argv, size_t def) {
+  if (argc > 1) {
+    return (std::strtoul(argv[1], NULL, 10));
+  }
+  return (def);
+}
+
+// 같은 측정을 여러 번 반복한 결과의 중앙값과 p99.
+struct summary {
+  double median;
+  double p99;
+};
+
+// samples는 복사해서 정렬한다. p99는 nearest-rank 방식이라 반복 횟수가
+// 100번보다 적으면 최댓값이 된다.
+inline summary summarize(std::vector< double > samples) {
+  summary s = {0, 0};
+
+  if (samples.empty()) {
+    return (s);
+  }
+  std::sort(samples.begin(), samples.end());
+  s.median = samples[samples.size() / 2];
+  size_t rank = (samples.size() * 99 + 99) / 100;
+  s.p99 = samples[rank - 1];
+  return (s);
+}
+
+// 크기 n짜리 측정을 몇 번 반복할지. 크기마다 대략 같은 시간이 걸리도록
+// n이 작을수록 많이 돌리되, [5, 51]번 사이로 자른다.
+inline size_t repeats_for(size_t n) {
+  size_t reps = 2000000 / (n ? n : 1);
+
+  return (std::max< size_t >(5, std::min< size_t >(51, reps)));
+}
+
+// 컴파일러가 결과를 버리지 못하게 출력해버린다.
+template < typename T >
+void keep(const T& val) {
+  std::cerr << "(checksum " << val << ")" << std::endl;
+}
+
+}  // namespace bench
+
+#endif  // BENCH_HPP
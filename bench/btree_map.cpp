@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "btree_map.hpp"
+#include "counting_allocator.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+
+/**
+ * btree_map과 map< int, int >의 insert / find / 순회 / erase ns/op와
+ * element 하나당 byte. (counting_allocator로 잰 사용 중인 heap / size)
+ * 같은 무작위 key를 하나씩 insert 하고, find는 절반은 없는 key,
+ * erase는 넣은 순서대로 모두 지운다.
+ * 마지막 줄은 가장 큰 크기에서 btree_map의 노드 크기별 find다.
+ * (BENCH_MAX로 1e7까지. map은 1e7에서 500MB 정도 쓴다)
+ */
+typedef ft::counting_allocator< ft::pair< const int, int > > counted;
+
+struct result {
+  double insert;
+  double find;
+  double iterate;
+  double erase;
+};
+
+template < typename Map >
+result run(const ft::vector< int >& keys, size_t queries, long& sum) {
+  result r;
+  Map mp;
+  bench::xorshift rng;
+  size_t n = keys.size();
+
+  bench::timer t_insert;
+  for (size_t i = 0; i < n; ++i) {
+    mp.insert(typename Map::value_type(keys[i], 1));
+  }
+  r.insert = t_insert.ns_per_op(n);
+
+  bench::timer t_find;
+  for (size_t i = 0; i < queries; ++i) {
+    typename Map::const_iterator it =
+        mp.find(static_cast< int >(rng.next() % (n * 2)));
+    if (it != mp.end()) sum += it->second;
+  }
+  r.find = t_find.ns_per_op(queries);
+
+  bench::timer t_iterate;
+  for (typename Map::const_iterator it = mp.begin(); it != mp.end(); ++it) {
+    sum += it->first;
+  }
+  r.iterate = t_iterate.ns_per_op(mp.size());
+
+  bench::timer t_erase;
+  for (size_t i = 0; i < n; ++i) {
+    sum += mp.erase(keys[i]);
+  }
+  r.erase = t_erase.ns_per_op(n);
+  return (r);
+}
+
+template < typename Map >
+double bytes_per_entry(const ft::vector< int >& keys) {
+  ft::alloc_stats stats;
+  Map mp((ft::less< int >()), counted(stats));
+
+  for (size_t i = 0; i < keys.size(); ++i) {
+    mp.insert(typename Map::value_type(keys[i], 1));
+  }
+  return (static_cast< double >(stats.bytes_in_use) / mp.size());
+}
+
+template < size_t NodeBytes >
+double find_with_node(const ft::vector< int >& keys, size_t queries,
+                      long& sum) {
+  typedef ft::btree_map< int, int, ft::less< int >,
+                         std::allocator< ft::pair< const int, int > >,
+                         NodeBytes >
+      btree_type;
+
+  return (run< btree_type >(keys, queries, sum).find);
+}
+
+int main(int argc, char** argv) {
+  typedef ft::map< int, int > map_type;
+  typedef ft::btree_map< int, int > btree_type;
+  typedef ft::map< int, int, ft::less< int >, counted > counted_map;
+  typedef ft::btree_map< int, int, ft::less< int >, counted > counted_btree;
+
+  const size_t max_size = bench::max_size_arg(argc, argv, 1000000);
+  const size_t queries = 1000000;
+  ft::vector< int > keys;
+  long sum = 0;
+
+  std::cout << "size\tinsert map/btree\tfind map/btree\titer map/btree"
+            << "\terase map/btree (ns/op)\tbytes/entry map/btree"
+            << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    bench::xorshift rng;
+
+    // 0 ~ 2n 중 짝수만 넣어서 홀수 key는 항상 없게 한다.
+    keys.clear();
+    for (size_t i = 0; i < n; ++i) {
+      keys.push_back(static_cast< int >(rng.next() % n) * 2);
+    }
+
+    result rm = run< map_type >(keys, queries, sum);
+    result rb = run< btree_type >(keys, queries, sum);
+    double map_bytes = bytes_per_entry< counted_map >(keys);
+    double btree_bytes = bytes_per_entry< counted_btree >(keys);
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t"
+              << rm.insert << " / " << rb.insert << "\t\t" << rm.find
+              << " / " << rb.find << "\t" << rm.iterate << " / "
+              << rb.iterate << "\t" << rm.erase << " / " << rb.erase
+              << "\t\t" << map_bytes << " / " << btree_bytes << std::endl;
+  }
+
+  std::cout << "find by node bytes 64/256/512/1024 (size " << keys.size()
+            << "): " << std::fixed << std::setprecision(1)
+            << find_with_node< 64 >(keys, queries, sum) << " / "
+            << find_with_node< 256 >(keys, queries, sum) << " / "
+            << find_with_node< 512 >(keys, queries, sum) << " / "
+            << find_with_node< 1024 >(keys, queries, sum) << std::endl;
+  bench::keep(sum);
+  return (0);
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_map.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "counting_allocator.hpp"
+#include "flat_map.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+
+/**
+ * flat_map과 map< int, int >의 key 탐색 ns/op와 element 하나당 byte.
+ * 둘 다 같은 무작위 key들을 insert(first, last)로 한 번에 넣고 만든다.
+ * 탐색은 절반은 있는 key, 절반은 없는 key.
+ * byte는 counting_allocator로 잰 사용 중인 heap 크기 / size다.
+ * (flat_map은 shrink_to_fit 전후를 같이 적는다)
+ */
+typedef ft::pair< int, int > entry;
+typedef ft::counting_allocator< ft::pair< const int, int > > counted;
+
+template < typename Map >
+double build(Map& mp, const ft::vector< entry >& src) {
+  bench::timer t;
+  mp.insert(src.begin(), src.end());
+  return (t.ns_per_op(src.size()));
+}
+
+template < typename Map >
+double lookup(const Map& mp, size_t n, size_t queries, long& sum) {
+  bench::xorshift rng;
+
+  bench::timer t;
+  for (size_t i = 0; i < queries; ++i) {
+    typename Map::const_iterator it =
+        mp.find(static_cast< int >(rng.next() % (n * 2)));
+    if (it != mp.end()) sum += it->second;
+  }
+  return (t.ns_per_op(queries));
+}
+
+template < typename Map >
+double bytes_per_entry(Map& mp, const ft::vector< entry >& src,
+                       ft::alloc_stats& stats) {
+  mp.insert(src.begin(), src.end());
+  return (static_cast< double >(stats.bytes_in_use) / mp.size());
+}
+
+int main(int argc, char** argv) {
+  typedef ft::map< int, int > map_type;
+  typedef ft::flat_map< int, int > flat_type;
+  typedef ft::map< int, int, ft::less< int >, counted > counted_map;
+  typedef ft::flat_map< int, int, ft::less< int >, counted > counted_flat;
+
+  const size_t max_size = bench::max_size_arg(argc, argv, 1000000);
+  const size_t queries = 1000000;
+  long sum = 0;
+
+  std::cout << "size\tbuild map/flat\tfind map/flat (ns/op)"
+            << "\tbytes/entry map/flat/shrunk" << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    ft::vector< entry > src;
+    bench::xorshift rng;
+
+    // 0 ~ 2n 중 짝수만 넣어서 홀수 key는 항상 없게 한다.
+    for (size_t i = 0; i < n; ++i) {
+      src.push_back(entry(static_cast< int >(rng.next() % n) * 2, 1));
+    }
+
+    map_type mp;
+    flat_type fm;
+    double build_map = build(mp, src);
+    double build_flat = build(fm, src);
+    double find_map = lookup(mp, n, queries, sum);
+    double find_flat = lookup(fm, n, queries, sum);
+
+    ft::alloc_stats map_stats;
+    ft::alloc_stats flat_stats;
+    counted_map cm((ft::less< int >()), counted(map_stats));
+    counted_flat cf((ft::less< int >()), counted(flat_stats));
+    double map_bytes = bytes_per_entry(cm, src, map_stats);
+    double flat_bytes = bytes_per_entry(cf, src, flat_stats);
+    cf.shrink_to_fit();
+    double shrunk_bytes =
+        static_cast< double >(flat_stats.bytes_in_use) / cf.size();
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t"
+              << build_map << " / " << build_flat << "\t" << find_map
+              << " / " << find_flat << "\t\t" << map_bytes << " / "
+              << flat_bytes << " / " << shrunk_bytes << std::endl;
+  }
+  bench::keep(sum);
+  return (0);
+}
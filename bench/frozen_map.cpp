@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen_map.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "flat_map.hpp"
+#include "map.hpp"
+
+/**
+ * map::freeze()로 만든 frozen_map(Eytzinger 배열)의 find ns/op.
+ * 같은 key들로 RB_Tree를 따라가는 map::find, 정렬된 배열을 binary search
+ * 하는 flat_map::find와 비교한다. 절반은 있는 key, 절반은 없는 key.
+ * 크기가 cache보다 커질수록 차이가 난다. (BENCH_MAX로 1e7, 1e8까지.
+ * 1e8은 map만 5GB 가까이 쓴다)
+ */
+template < typename Map >
+double lookup(const Map& mp, size_t n, size_t queries, long& sum) {
+  bench::xorshift rng;
+
+  bench::timer t;
+  for (size_t i = 0; i < queries; ++i) {
+    typename Map::const_iterator it =
+        mp.find(static_cast< int >(rng.next() % (n * 2)));
+    if (it != mp.end()) sum += it->second;
+  }
+  return (t.ns_per_op(queries));
+}
+
+int main(int argc, char** argv) {
+  typedef ft::map< int, int > map_type;
+
+  const size_t max_size = bench::max_size_arg(argc, argv, 1000000);
+  const size_t queries = 1000000;
+  long sum = 0;
+
+  std::cout << "size\tfreeze\tfind map / flat / frozen (ns/op)" << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    map_type mp;
+    bench::xorshift rng;
+
+    // 0 ~ 2n 중 짝수만 넣어서 홀수 key는 항상 없게 한다.
+    for (size_t i = 0; i < n; ++i) {
+      mp.insert(ft::make_pair(static_cast< int >(rng.next() % n) * 2, 1));
+    }
+    bench::timer t;
+    map_type::frozen_type frozen = mp.freeze();
+    double freeze = t.ns_per_op(mp.size());
+    ft::flat_map< int, int > flat(mp.begin(), mp.end());
+
+    double find_map = lookup(mp, n, queries, sum);
+    double find_flat = lookup(flat, n, queries, sum);
+    double find_frozen = lookup(frozen, n, queries, sum);
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t" << freeze
+              << "\t" << find_map << " / " << find_flat << " / "
+              << find_frozen << std::endl;
+  }
+  bench::keep(sum);
+  return (0);
+}
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   iterator_loop.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+
+/**
+ * ft::vector를 iterator로 도는 loop가 raw pointer loop와 같은 속도인지.
+ * iterator가 pointer 하나짜리 trivially copyable type이면 컴파일러가
+ * register에 두고 vectorize 할 수 있어서 두 loop의 ns/elem이 같아야 한다.
+ */
+template < typename Iterator >
+long sum_range(Iterator first, Iterator last) {
+  long sum = 0;
+
+  for (; first != last; ++first) {
+    sum += *first;
+  }
+  return (sum);
+}
+
+int main(int argc, char** argv) {
+  const size_t n = bench::max_size_arg(argc, argv, 1000000);
+  const int rounds = 100;
+  bench::xorshift rng;
+  ft::vector< int > v;
+  long sum = 0;
+
+  for (size_t i = 0; i < n; ++i) {
+    v.push_back(static_cast< int >(rng.next() & 0xff));
+  }
+
+  std::cout << "sizeof(ft::vector< int >::iterator): "
+            << sizeof(ft::vector< int >::iterator) << ", trivially copyable: "
+            << ft::is_trivially_copyable< ft::vector< int >::iterator >::value
+            << std::endl;
+  std::cout << "size: " << n << "  (ns/elem)" << std::endl;
+
+  bench::timer t;
+  for (int r = 0; r < rounds; ++r) {
+    const int* p = &v[0];
+    const int* end = p + v.size();
+    for (; p != end; ++p) {
+      sum += *p;
+    }
+  }
+  double raw = t.ns_per_op(n * rounds);
+
+  t.reset();
+  for (int r = 0; r < rounds; ++r) {
+    for (ft::vector< int >::const_iterator it = v.begin(); it != v.end();
+         ++it) {
+      sum += *it;
+    }
+  }
+  double iter = t.ns_per_op(n * rounds);
+
+  t.reset();
+  for (int r = 0; r < rounds; ++r) {
+    sum += sum_range(v.begin(), v.end());
+  }
+  double by_value = t.ns_per_op(n * rounds);
+
+  t.reset();
+  for (int r = 0; r < rounds; ++r) {
+    sum += sum_range(v.rbegin(), v.rend());
+  }
+  double reverse = t.ns_per_op(n * rounds);
+
+  std::cout << std::fixed << std::setprecision(3) << "raw pointer\t" << raw
+            << "\niterator\t" << iter << "\nsum_range(it)\t" << by_value
+            << "\nsum_range(rit)\t" << reverse << std::endl;
+
+  // map은 loop가 pointer chasing이라 iterator 크기의 영향만 본다.
+  ft::map< int, int > m;
+  for (size_t i = 0; i < n / 10; ++i) {
+    m.insert(ft::make_pair(static_cast< int >(i), static_cast< int >(i)));
+  }
+  t.reset();
+  for (int r = 0; r < rounds / 10; ++r) {
+    for (ft::map< int, int >::const_iterator it = m.begin(); it != m.end();
+         ++it) {
+      sum += it->second;
+    }
+  }
+  std::cout << "map iterator\t" << t.ns_per_op(m.size() * (rounds / 10))
+            << std::endl;
+  bench::keep(sum);
+  return (0);
+}
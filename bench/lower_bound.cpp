@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lower_bound.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "map.hpp"
+
+/**
+ * map::lower_bound / upper_bound / equal_range 의 크기별 ns/op.
+ * 짝수 key만 넣어두고 임의의 key로 질의한다.
+ * 탐색이 O(log n)이면 크기가 10배 늘어도 ns/op는 조금씩만 늘어야 한다.
+ */
+int main(int argc, char** argv) {
+  const size_t max_size = bench::max_size_arg(argc, argv, 10000000);
+  const size_t queries = 1000000;
+  long checksum = 0;
+
+  std::cout << "size\tlower_bound\tupper_bound\tequal_range\t(ns/op)"
+            << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    ft::map< long, long > mp;
+    bench::xorshift rng;
+
+    for (size_t i = 0; i < n; ++i) {
+      mp.insert(ft::make_pair(static_cast< long >(i * 2), 0L));
+    }
+
+    bench::timer t;
+    for (size_t i = 0; i < queries; ++i) {
+      ft::map< long, long >::iterator it =
+          mp.lower_bound(static_cast< long >(rng.next() % (n * 2)));
+      if (it != mp.end()) checksum += it->first;
+    }
+    double lower = t.ns_per_op(queries);
+
+    t.reset();
+    for (size_t i = 0; i < queries; ++i) {
+      ft::map< long, long >::iterator it =
+          mp.upper_bound(static_cast< long >(rng.next() % (n * 2)));
+      if (it != mp.end()) checksum += it->first;
+    }
+    double upper = t.ns_per_op(queries);
+
+    t.reset();
+    for (size_t i = 0; i < queries; ++i) {
+      ft::pair< ft::map< long, long >::iterator,
+                ft::map< long, long >::iterator >
+          range = mp.equal_range(static_cast< long >(rng.next() % (n * 2)));
+      if (range.first != range.second) ++checksum;
+    }
+    double equal = t.ns_per_op(queries);
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t" << lower
+              << "\t\t" << upper << "\t\t" << equal << std::endl;
+  }
+  bench::keep(checksum);
+  return (0);
+}
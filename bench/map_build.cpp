@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_build.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+#include "bench.hpp"
+#include "map.hpp"
+
+/**
+ * range constructor로 map을 만드는 비용.
+ * sorted: 이미 정렬된 키, shuffled: 섞인 키 (둘 다 중복 없음)
+ */
+int main(int argc, char** argv) {
+  typedef ft::map< long, long > map_type;
+  typedef std::vector< ft::pair< long, long > > input_type;
+
+  const size_t max_size = bench::max_size_arg(argc, argv, 10000000);
+  long sum = 0;
+
+  std::cout << "size\tsorted\tshuffled\t(ns/elem)" << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    input_type sorted;
+    bench::xorshift rng;
+
+    for (size_t i = 0; i < n; ++i) {
+      sorted.push_back(ft::make_pair(static_cast< long >(i), 0L));
+    }
+    input_type shuffled(sorted);
+    for (size_t i = n - 1; i > 0; --i) {
+      std::swap(shuffled[i], shuffled[rng.next() % (i + 1)]);
+    }
+
+    bench::timer t;
+    {
+      map_type mp(sorted.begin(), sorted.end());
+      sum += mp.size();
+    }
+    double sorted_ns = t.ns_per_op(n);
+
+    t.reset();
+    {
+      map_type mp(shuffled.begin(), shuffled.end());
+      sum += mp.size();
+    }
+    double shuffled_ns = t.ns_per_op(n);
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t" << sorted_ns
+              << "\t" << shuffled_ns << std::endl;
+  }
+  bench::keep(sum);
+  return (0);
+}
@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_copy.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "map.hpp"
+
+/**
+ * map 복사 처리량. copy는 빈 map으로 복사 생성, assign은 같은 크기의 map에
+ * operator= 로 덮어쓰는 경우. (기존 노드 재사용)
+ */
+int main(int argc, char** argv) {
+  typedef ft::map< long, long > map_type;
+
+  const size_t max_size = bench::max_size_arg(argc, argv, 1000000);
+  long sum = 0;
+
+  std::cout << "size\tcopy\tassign\t(ns/elem)" << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    map_type src;
+    map_type dst;
+    bench::xorshift rng;
+    const size_t rounds = max_size / n;
+
+    while (src.size() < n) {
+      src.insert(ft::make_pair(static_cast< long >(rng.next()), 0L));
+    }
+    while (dst.size() < n) {
+      dst.insert(ft::make_pair(static_cast< long >(rng.next()), 0L));
+    }
+
+    bench::timer t;
+    for (size_t i = 0; i < rounds; ++i) {
+      map_type copied(src);
+      sum += copied.size();
+    }
+    double copy = t.ns_per_op(rounds * n);
+
+    t.reset();
+    for (size_t i = 0; i < rounds; ++i) {
+      dst = src;
+      sum += dst.size();
+    }
+    double assign = t.ns_per_op(rounds * n);
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t" << copy
+              << "\t" << assign << std::endl;
+  }
+  bench::keep(sum);
+  return (0);
+}
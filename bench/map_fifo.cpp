@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_fifo.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "map.hpp"
+
+/**
+ * begin() / erase(begin()) 를 반복하는 FIFO 패턴과 rbegin() 조회 비용.
+ * 매 반복마다 뒤쪽에 새 키를 넣으므로 크기는 n으로 유지된다.
+ */
+int main(int argc, char** argv) {
+  const size_t max_size = bench::max_size_arg(argc, argv, 10000000);
+  long sum = 0;
+
+  std::cout << "size\tfifo\tbegin\trbegin\t(ns/op)" << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    ft::map< long, long > mp;
+    for (size_t i = 0; i < n; ++i) {
+      mp.insert(ft::make_pair(static_cast< long >(i), 0L));
+    }
+
+    bench::timer t;
+    for (size_t i = 0; i < n; ++i) {
+      sum += mp.begin()->first;
+      mp.erase(mp.begin());
+      mp.insert(mp.end(), ft::make_pair(static_cast< long >(n + i), 0L));
+    }
+    double fifo = t.ns_per_op(n);
+
+    t.reset();
+    for (size_t i = 0; i < n; ++i) {
+      sum += mp.begin()->first;
+    }
+    double begin = t.ns_per_op(n);
+
+    t.reset();
+    for (size_t i = 0; i < n; ++i) {
+      sum += mp.rbegin()->first;
+    }
+    double rbegin = t.ns_per_op(n);
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t" << fifo
+              << "\t" << begin << "\t" << rbegin << std::endl;
+  }
+  bench::keep(sum);
+  return (0);
+}
@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_lookup.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+
+/**
+ * map< int, std::string > 의 key 탐색 ns/op.
+ * key만으로 tree를 탐색하므로 질의할 때마다 value_type(k, mapped_type())을
+ * 만들지 않는다.
+ * 마지막으로 std::string key의 map을 길이를 아는 문자열 view로 찾는 경우를
+ * std::string을 만들어서 찾는 경우와 비교한다. (transparent comparator)
+ */
+struct str_view {
+  const char* data;
+  size_t size;
+};
+
+struct view_less {
+  typedef void is_transparent;
+
+  bool operator()(const std::string& x, const std::string& y) const {
+    return (x < y);
+  }
+  bool operator()(const std::string& x, const str_view& y) const {
+    return (x.compare(0, std::string::npos, y.data, y.size) < 0);
+  }
+  bool operator()(const str_view& x, const std::string& y) const {
+    return (y.compare(0, std::string::npos, x.data, x.size) > 0);
+  }
+};
+
+// str_view와 같은 모양으로 만들어 std::string으로 변환해 찾는 경우.
+struct string_key {
+  const char* data;
+  size_t size;
+
+  operator std::string() const { return (std::string(data, size)); }
+};
+
+template < typename Map, typename Key >
+double find_by(const ft::vector< std::string >& keys, size_t queries,
+               long& checksum) {
+  Map mp;
+  bench::xorshift rng;
+
+  for (size_t i = 0; i < keys.size(); ++i) {
+    mp.insert(ft::make_pair(keys[i], static_cast< int >(i)));
+  }
+  bench::timer t;
+  for (size_t i = 0; i < queries; ++i) {
+    const std::string& k = keys[rng.next() % keys.size()];
+    Key key = {k.data(), k.size()};
+    typename Map::iterator it = mp.find(key);
+    if (it != mp.end()) checksum += it->second;
+  }
+  return (t.ns_per_op(queries));
+}
+
+int main(int argc, char** argv) {
+  typedef ft::map< int, std::string > map_type;
+
+  const size_t max_size = bench::max_size_arg(argc, argv, 1000000);
+  const size_t queries = 1000000;
+  long checksum = 0;
+
+  std::cout << "size\tfind\tcount\tlower_bound\terase miss\t(ns/op)"
+            << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    map_type mp;
+    bench::xorshift rng;
+
+    for (size_t i = 0; i < n; ++i) {
+      mp.insert(ft::make_pair(static_cast< int >(i * 2),
+                              std::string("value for the benchmark")));
+    }
+
+    bench::timer t;
+    for (size_t i = 0; i < queries; ++i) {
+      map_type::iterator it = mp.find(static_cast< int >(rng.next() % n));
+      if (it != mp.end()) checksum += it->second.size();
+    }
+    double find = t.ns_per_op(queries);
+
+    t.reset();
+    for (size_t i = 0; i < queries; ++i) {
+      checksum += mp.count(static_cast< int >(rng.next() % n));
+    }
+    double count = t.ns_per_op(queries);
+
+    t.reset();
+    for (size_t i = 0; i < queries; ++i) {
+      map_type::iterator it =
+          mp.lower_bound(static_cast< int >(rng.next() % n));
+      if (it != mp.end()) checksum += it->first;
+    }
+    double lower = t.ns_per_op(queries);
+
+    t.reset();
+    for (size_t i = 0; i < queries; ++i) {
+      checksum += mp.erase(static_cast< int >(rng.next() % n) * 2 + 1);
+    }
+    double erase = t.ns_per_op(queries);
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t" << find
+              << "\t" << count << "\t" << lower << "\t\t" << erase
+              << std::endl;
+  }
+
+  // SSO에 들어가지 않는 길이의 key.
+  ft::vector< std::string > keys;
+  for (size_t i = 0; i < 10000; ++i) {
+    std::string k;
+    for (size_t v = i + 1; v > 0; v /= 10) {
+      k += static_cast< char >('0' + v % 10);
+    }
+    keys.push_back(k + " is a key long enough to defeat sso");
+  }
+  std::cout << "find on " << keys.size() << " std::string keys: "
+            << std::fixed << std::setprecision(1)
+            << find_by< ft::map< std::string, int >, string_key >(
+                   keys, queries, checksum)
+            << " ns/op (std::string), "
+            << find_by< ft::map< std::string, int, view_less >, str_view >(
+                   keys, queries, checksum)
+            << " ns/op (str_view)" << std::endl;
+
+  bench::keep(checksum);
+  return (0);
+}
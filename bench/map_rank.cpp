@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_rank.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "map.hpp"
+
+/**
+ * Ranked map의 order-statistic 연산과, 그 대신 늘어나는 insert / erase 비용.
+ * k번째 찾기와 distance는 Ranked가 아닌 map에서 한 칸씩 세는 것과 비교한다.
+ * (선형 쪽은 느리므로 질의 수를 줄여서 잰다)
+ */
+typedef ft::map< int, int > plain_map;
+typedef ft::map< int, int, ft::less< int >,
+                 std::allocator< ft::pair< const int, int > >, true >
+    ranked_map;
+
+template < typename Map >
+double build(Map& mp, size_t n, long& sum) {
+  bench::xorshift rng;
+
+  bench::timer t;
+  for (size_t i = 0; i < n; ++i) {
+    mp.insert(ft::make_pair(static_cast< int >(rng.next() % (n * 4)), 0));
+  }
+  double ns = t.ns_per_op(n);
+  sum += mp.size();
+  return (ns);
+}
+
+template < typename Map >
+double erase_half(Map mp, size_t n, long& sum) {
+  bench::xorshift rng;
+
+  bench::timer t;
+  for (size_t i = 0; i < n / 2; ++i) {
+    sum += mp.erase(static_cast< int >(rng.next() % (n * 4)));
+  }
+  return (t.ns_per_op(n / 2));
+}
+
+int main(int argc, char** argv) {
+  const size_t max_size = bench::max_size_arg(argc, argv, 1000000);
+  const size_t queries = 100000;
+  long sum = 0;
+
+  std::cout << "node bytes: plain " << sizeof(plain_map::node_type)
+            << ", ranked " << sizeof(ranked_map::node_type) << std::endl;
+  std::cout << "size\tinsert plain/ranked\terase plain/ranked\tnth\tadvance"
+            << "\tdistance\tlinear\t(ns/op)" << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    plain_map pm;
+    ranked_map rm;
+    double ins_p = build(pm, n, sum);
+    double ins_r = build(rm, n, sum);
+    double era_p = erase_half(pm, n, sum);
+    double era_r = erase_half(rm, n, sum);
+    bench::xorshift rng;
+
+    bench::timer t;
+    for (size_t i = 0; i < queries; ++i) {
+      sum += rm.nth(rng.next() % rm.size())->first;
+    }
+    double nth = t.ns_per_op(queries);
+
+    // 한 칸씩 가는 쪽은 크기에 비례하므로 질의 수를 줄인다.
+    size_t slow = queries * 1000 / n;
+    t.reset();
+    for (size_t i = 0; i < slow; ++i) {
+      plain_map::iterator it = pm.begin();
+      ft::advance(it, rng.next() % pm.size());
+      sum += it->first;
+    }
+    double advance = t.ns_per_op(slow);
+
+    t.reset();
+    for (size_t i = 0; i < queries; ++i) {
+      int key = static_cast< int >(rng.next() % (n * 4));
+      sum += ft::distance(rm.begin(), rm.lower_bound(key));
+    }
+    double dist = t.ns_per_op(queries);
+
+    t.reset();
+    for (size_t i = 0; i < slow; ++i) {
+      int key = static_cast< int >(rng.next() % (n * 4));
+      sum += ft::distance(pm.begin(), pm.lower_bound(key));
+    }
+    double linear = t.ns_per_op(slow);
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t" << ins_p
+              << " / " << ins_r << "\t\t" << era_p << " / " << era_r
+              << "\t\t" << nth << "\t" << advance << "\t" << dist << "\t\t"
+              << linear << std::endl;
+  }
+  bench::keep(sum);
+  return (0);
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_subscript.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "bench.hpp"
+#include "map.hpp"
+
+/**
+ * 이미 있는 key에 대한 operator[] 와 insert 의 ns/op.
+ * (hit인 경우 노드를 만들지 않아야 한다)
+ */
+int main(int argc, char** argv) {
+  typedef ft::map< long, std::string > map_type;
+
+  const size_t max_size = bench::max_size_arg(argc, argv, 1000000);
+  const size_t queries = 1000000;
+  long checksum = 0;
+
+  std::cout << "size\t[] hit\tinsert hit\t(ns/op)" << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    map_type mp;
+    bench::xorshift rng;
+
+    for (size_t i = 0; i < n; ++i) {
+      mp[static_cast< long >(i)] = "value for the benchmark";
+    }
+
+    bench::timer t;
+    for (size_t i = 0; i < queries; ++i) {
+      checksum += mp[static_cast< long >(rng.next() % n)].size();
+    }
+    double subscript = t.ns_per_op(queries);
+
+    const map_type::value_type val(0, "value for the benchmark");
+    t.reset();
+    for (size_t i = 0; i < queries; ++i) {
+      checksum += mp.insert(val).second;
+    }
+    double insert = t.ns_per_op(queries);
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t" << subscript
+              << "\t" << insert << std::endl;
+  }
+  bench::keep(checksum);
+  return (0);
+}
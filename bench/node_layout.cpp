@@ -0,0 +1,63 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_layout.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "map.hpp"
+
+/**
+ * RB_TreeNode 하나가 차지하는 메모리와 map::find 의 크기별 ns/op.
+ * 노드에 value를 같이 담으므로 element 하나당 할당은 1번이다.
+ */
+int main(int argc, char** argv) {
+  typedef ft::map< int, int > map_type;
+  typedef map_type::node_type node_type;
+
+  const size_t max_size = bench::max_size_arg(argc, argv, 10000000);
+  const size_t queries = 1000000;
+  long checksum = 0;
+
+  std::cout << "sizeof(value_type): " << sizeof(map_type::value_type)
+            << std::endl;
+  std::cout << "sizeof(node_type): " << sizeof(node_type) << std::endl;
+
+  std::cout << "size\tfind\t\tfind miss\t(ns/op)" << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    map_type mp;
+    bench::xorshift rng;
+
+    for (size_t i = 0; i < n; ++i) {
+      mp.insert(ft::make_pair(static_cast< int >(rng.next() % n) * 2, 0));
+    }
+
+    bench::timer t;
+    for (size_t i = 0; i < queries; ++i) {
+      int key = static_cast< int >(rng.next() % n) * 2;
+      checksum += mp.find(key) != mp.end();
+    }
+    double found = t.ns_per_op(queries);
+
+    t.reset();
+    for (size_t i = 0; i < queries; ++i) {
+      int key = static_cast< int >(rng.next() % n) * 2 + 1;
+      checksum += mp.find(key) != mp.end();
+    }
+    double miss = t.ns_per_op(queries);
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t" << found
+              << "\t\t" << miss << std::endl;
+  }
+  bench::keep(checksum);
+  return (0);
+}
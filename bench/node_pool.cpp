@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_pool.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "pool_allocator.hpp"
+
+/**
+ * insert/erase가 섞인 churn에서 std::allocator와 ft::pool_allocator 비교.
+ * n개를 채운 뒤 insert 1번 + erase 1번을 n번 반복하고, 마지막에 clear 한다.
+ */
+template < typename Map >
+void churn(size_t n, double& fill, double& mix, double& clear, long& sum) {
+  Map mp;
+  bench::xorshift rng;
+
+  bench::timer t;
+  for (size_t i = 0; i < n; ++i) {
+    mp.insert(ft::make_pair(static_cast< long >(rng.next() % (n * 4)), 0L));
+  }
+  fill = t.ns_per_op(n);
+
+  t.reset();
+  for (size_t i = 0; i < n; ++i) {
+    mp.insert(ft::make_pair(static_cast< long >(rng.next() % (n * 4)), 0L));
+    sum += mp.erase(static_cast< long >(rng.next() % (n * 4)));
+  }
+  mix = t.ns_per_op(n * 2);
+
+  sum += mp.size();
+  t.reset();
+  mp.clear();
+  clear = t.ns_per_op(n);
+}
+
+int main(int argc, char** argv) {
+  typedef ft::map< long, long > std_map;
+  typedef ft::map< long, long, ft::less< long >,
+                   ft::pool_allocator< ft::pair< const long, long > > >
+      pool_map;
+
+  const size_t max_size = bench::max_size_arg(argc, argv, 10000000);
+  long sum = 0;
+
+  std::cout << "size\tallocator\tfill\tchurn\tclear\t(ns/op)" << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    double fill, mix, clear;
+
+    churn< std_map >(n, fill, mix, clear, sum);
+    std::cout << n << std::fixed << std::setprecision(1) << "\tstd\t\t"
+              << fill << "\t" << mix << "\t" << clear << std::endl;
+    churn< pool_map >(n, fill, mix, clear, sum);
+    std::cout << n << std::fixed << std::setprecision(1) << "\tpool\t\t"
+              << fill << "\t" << mix << "\t" << clear << std::endl;
+  }
+  bench::keep(sum);
+  return (0);
+}
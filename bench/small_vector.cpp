@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "small_vector.hpp"
+#include "vector.hpp"
+
+/**
+ * 짧은 vector를 많이 만드는 경우. len개를 push_back 하고 합을 구한 뒤
+ * 버리는 것을 반복한다. small_vector< int, 8 >은 len이 8 이하면 heap
+ * 할당이 없다.
+ */
+template < typename Vector >
+double run_temp(size_t count, size_t len, long& sum) {
+  bench::xorshift rng;
+
+  bench::timer t;
+  for (size_t i = 0; i < count; ++i) {
+    Vector v;
+    for (size_t j = 0; j < len; ++j) {
+      v.push_back(static_cast< int >(rng.next() & 0xff));
+    }
+    for (typename Vector::const_iterator it = v.begin(); it != v.end(); ++it) {
+      sum += *it;
+    }
+  }
+  return (t.ns_per_op(count));
+}
+
+/**
+ * 인접 리스트처럼 짧은 vector를 vector에 담아두고 읽는 경우.
+ * inline 이면 element가 바깥 vector의 buffer 안에 같이 놓인다.
+ */
+template < typename Vector >
+double run_nested(size_t count, size_t len, long& sum) {
+  bench::xorshift rng;
+  ft::vector< Vector > outer(count);
+
+  for (size_t i = 0; i < count; ++i) {
+    for (size_t j = 0; j < len; ++j) {
+      outer[i].push_back(static_cast< int >(rng.next() & 0xff));
+    }
+  }
+  bench::timer t;
+  for (int round = 0; round < 10; ++round) {
+    for (size_t i = 0; i < count; ++i) {
+      const Vector& v = outer[i];
+      for (size_t j = 0; j < v.size(); ++j) {
+        sum += v[j];
+      }
+    }
+  }
+  return (t.ns_per_op(count * 10));
+}
+
+int main(int argc, char** argv) {
+  const size_t count = bench::max_size_arg(argc, argv, 1000000);
+  const size_t lens[] = {2, 4, 8, 16, 32};
+  long sum = 0;
+
+  std::cout << "count: " << count << "  (ns per vector)" << std::endl;
+  std::cout << "len\ttemp:vector\ttemp:small<8>\tnested:vector\tnested:small<8>"
+            << std::endl;
+  for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); ++i) {
+    double tv = run_temp< ft::vector< int > >(count, lens[i], sum);
+    double ts = run_temp< ft::small_vector< int, 8 > >(count, lens[i], sum);
+    double nv = run_nested< ft::vector< int > >(count, lens[i], sum);
+    double ns = run_nested< ft::small_vector< int, 8 > >(count, lens[i], sum);
+
+    std::cout << lens[i] << "\t" << std::fixed << std::setprecision(2) << tv
+              << "\t\t" << ts << "\t\t" << nv << "\t\t" << ns << std::endl;
+  }
+  bench::keep(sum);
+  return (0);
+}
@@ -0,0 +1,474 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   suite.cpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "counting_allocator.hpp"
+#include "map.hpp"
+#include "set.hpp"
+#include "stack.hpp"
+#include "vector.hpp"
+
+/**
+ * ft:: 와 std:: container를 같은 binary에서 같은 입력으로 재는 benchmark.
+ * 크기마다 측정을 여러 번 반복해서 ns/op의 중앙값과 p99를 낸다.
+ * 결과는 표로 출력하고, release 사이에 diff 할 수 있도록 CSV로도 쓴다.
+ *
+ * 각 suite의 연산은 (미리 채워둔 container, key들, checksum)을 받아 한 번
+ * 측정한 ns/op를 리턴한다. container를 채우거나 복사하는 시간은 재지 않는다.
+ * stack은 각자의 기본 container(ft::vector, std::deque)로 비교한다.
+ *
+ * 시간을 잰 다음, 같은 연산을 ft::counting_allocator를 쓰는 container로 한
+ * 번 더 돌려서 연산 하나당 allocate / deallocate 횟수, 연산 동안 늘어난
+ * 최대 byte, 연산별 allocate 횟수의 histogram을 같이 낸다.
+ * (시간은 std::allocator 쪽만 재므로 세는 비용은 시간에 들어가지 않는다)
+ */
+typedef std::vector< int > keys_type;
+
+// 한 번에 재기에는 너무 느린 연산(vector 중간 insert/erase)의 횟수.
+static const size_t middle_ops = 1000;
+
+// 연산 구간 표시. counting_allocator를 쓰는 container일 때만 기록하고,
+// 나머지는 빈 함수라 시간 측정에 영향이 없다.
+template < typename Alloc >
+struct op_marker {
+  static void begin() {}
+  static void done() {}
+};
+
+template < typename T, typename A >
+struct op_marker< ft::counting_allocator< T, A > > {
+  static void begin() { ft::default_alloc_stats().begin_ops(); }
+  static void done() { ft::default_alloc_stats().end_op(); }
+};
+
+template < typename Vector >
+struct vector_suite {
+  typedef Vector container_type;
+  typedef op_marker< typename Vector::allocator_type > marker;
+
+  static void fill(Vector& v, const keys_type& keys) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+      v.push_back(keys[i]);
+    }
+  }
+
+  static double push_back(const Vector&, const keys_type& keys, long& sum) {
+    Vector v;
+
+    bench::timer t;
+    marker::begin();
+    for (size_t i = 0; i < keys.size(); ++i) {
+      v.push_back(keys[i]);
+      marker::done();
+    }
+    double ns = t.ns_per_op(keys.size());
+    sum += v.back();
+    return (ns);
+  }
+
+  static double insert(const Vector& base, const keys_type& keys, long& sum) {
+    Vector v(base);
+    size_t ops = std::min(middle_ops, keys.size());
+
+    bench::timer t;
+    marker::begin();
+    for (size_t i = 0; i < ops; ++i) {
+      v.insert(v.begin() + v.size() / 2, keys[i]);
+      marker::done();
+    }
+    double ns = t.ns_per_op(ops);
+    sum += v[v.size() / 2];
+    return (ns);
+  }
+
+  static double erase(const Vector& base, const keys_type& keys, long& sum) {
+    Vector v(base);
+    size_t ops = std::min(middle_ops, keys.size());
+
+    bench::timer t;
+    marker::begin();
+    for (size_t i = 0; i < ops; ++i) {
+      v.erase(v.begin() + v.size() / 2);
+      marker::done();
+    }
+    double ns = t.ns_per_op(ops);
+    sum += v.size();
+    return (ns);
+  }
+};
+
+// set은 key 그대로, map은 (key, key) pair를 넣는다.
+inline int make_value(int key, int*) { return (key); }
+
+template < typename Pair >
+Pair make_value(int key, Pair*) {
+  return (Pair(key, key));
+}
+
+// map과 set이 같이 쓴다.
+template < typename Tree >
+struct tree_suite {
+  typedef Tree container_type;
+  typedef typename Tree::value_type value_type;
+  typedef op_marker< typename Tree::allocator_type > marker;
+
+  static value_type make(int key) {
+    return (make_value(key, static_cast< value_type* >(0)));
+  }
+
+  static void fill(Tree& tr, const keys_type& keys) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+      tr.insert(make(keys[i]));
+    }
+  }
+
+  static double insert(const Tree&, const keys_type& keys, long& sum) {
+    Tree tr;
+
+    bench::timer t;
+    marker::begin();
+    for (size_t i = 0; i < keys.size(); ++i) {
+      tr.insert(make(keys[i]));
+      marker::done();
+    }
+    double ns = t.ns_per_op(keys.size());
+    sum += tr.size();
+    return (ns);
+  }
+
+  // key는 모두 짝수라서 홀수로 찾으면 miss. hit와 miss를 반씩 섞는다.
+  static double find(const Tree& tr, const keys_type& keys, long& sum) {
+    bench::timer t;
+    marker::begin();
+    for (size_t i = 0; i < keys.size(); ++i) {
+      sum += tr.find(keys[i] + (i & 1)) != tr.end();
+      marker::done();
+    }
+    return (t.ns_per_op(keys.size()));
+  }
+
+  static double lower_bound(const Tree& tr, const keys_type& keys, long& sum) {
+    bench::timer t;
+    marker::begin();
+    for (size_t i = 0; i < keys.size(); ++i) {
+      sum += tr.lower_bound(keys[i] + (i & 1)) != tr.end();
+      marker::done();
+    }
+    return (t.ns_per_op(keys.size()));
+  }
+
+  static double erase(const Tree& base, const keys_type& keys, long& sum) {
+    Tree tr(base);
+
+    bench::timer t;
+    marker::begin();
+    for (size_t i = 0; i < keys.size(); ++i) {
+      sum += tr.erase(keys[i]);
+      marker::done();
+    }
+    return (t.ns_per_op(keys.size()));
+  }
+
+  static double iterate(const Tree& tr, const keys_type& keys, long& sum) {
+    typename Tree::const_iterator it = tr.begin();
+    typename Tree::const_iterator end = tr.end();
+
+    bench::timer t;
+    marker::begin();
+    for (; it != end; ++it) {
+      ++sum;
+      marker::done();
+    }
+    return (t.ns_per_op(keys.size()));
+  }
+};
+
+template < typename Stack >
+struct stack_suite {
+  typedef Stack container_type;
+  typedef op_marker< typename Stack::container_type::allocator_type > marker;
+
+  static void fill(Stack& st, const keys_type& keys) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+      st.push(keys[i]);
+    }
+  }
+
+  static double push(const Stack&, const keys_type& keys, long& sum) {
+    Stack st;
+
+    bench::timer t;
+    marker::begin();
+    for (size_t i = 0; i < keys.size(); ++i) {
+      st.push(keys[i]);
+      marker::done();
+    }
+    double ns = t.ns_per_op(keys.size());
+    sum += st.top();
+    return (ns);
+  }
+
+  static double pop(const Stack& base, const keys_type& keys, long& sum) {
+    Stack st(base);
+
+    bench::timer t;
+    marker::begin();
+    for (size_t i = 0; i < keys.size(); ++i) {
+      sum += st.top();
+      st.pop();
+      marker::done();
+    }
+    return (t.ns_per_op(keys.size()));
+  }
+};
+
+/**
+ * 비교할 container 네 벌. 시간을 재는 ft / std와, 같은 container에
+ * counting_allocator를 넣은 ft / std.
+ */
+typedef ft::counting_allocator< int > counted_int;
+
+struct vector_family {
+  typedef vector_suite< ft::vector< int > > ft_suite;
+  typedef vector_suite< std::vector< int > > std_suite;
+  typedef vector_suite< ft::vector< int, counted_int > > ft_counted;
+  typedef vector_suite< std::vector< int, counted_int > > std_counted;
+};
+
+struct map_family {
+  typedef ft::counting_allocator< ft::pair< const int, int > > ft_alloc;
+  typedef ft::counting_allocator< std::pair< const int, int > > std_alloc;
+
+  typedef tree_suite< ft::map< int, int > > ft_suite;
+  typedef tree_suite< std::map< int, int > > std_suite;
+  typedef tree_suite< ft::map< int, int, ft::less< int >, ft_alloc > >
+      ft_counted;
+  typedef tree_suite< std::map< int, int, std::less< int >, std_alloc > >
+      std_counted;
+};
+
+struct set_family {
+  typedef tree_suite< ft::set< int > > ft_suite;
+  typedef tree_suite< std::set< int > > std_suite;
+  typedef tree_suite< ft::set< int, ft::less< int >, counted_int > >
+      ft_counted;
+  typedef tree_suite< std::set< int, std::less< int >, counted_int > >
+      std_counted;
+};
+
+struct stack_family {
+  typedef stack_suite< ft::stack< int > > ft_suite;
+  typedef stack_suite< std::stack< int > > std_suite;
+  typedef stack_suite< ft::stack< int, ft::vector< int, counted_int > > >
+      ft_counted;
+  typedef stack_suite< std::stack< int, std::deque< int, counted_int > > >
+      std_counted;
+};
+
+/**
+ * 연산 이름과 suite의 함수를 이어주는 tag.
+ * compare는 tag 하나로 네 벌의 suite에서 같은 연산을 꺼내 쓴다.
+ */
+#define SUITE_OP(op)                                                     \
+  struct op##_op {                                                       \
+    static const char* name() { return (#op); }                          \
+    template < typename Suite >                                          \
+    static double run(const typename Suite::container_type& c,           \
+                      const keys_type& keys, long& sum) {                \
+      return (Suite::op(c, keys, sum));                                  \
+    }                                                                    \
+  }
+
+SUITE_OP(push_back);
+SUITE_OP(insert);
+SUITE_OP(erase);
+SUITE_OP(find);
+SUITE_OP(lower_bound);
+SUITE_OP(iterate);
+SUITE_OP(push);
+SUITE_OP(pop);
+
+#undef SUITE_OP
+
+// counting_allocator로 돌린 연산 한 번의 기록.
+struct alloc_summary {
+  double allocs_per_op;
+  double frees_per_op;
+  size_t peak_bytes;
+  size_t histogram[ft::alloc_stats::histogram_size];
+};
+
+// 결과를 표(stdout)와 CSV 파일에 같이 쓴다.
+class report {
+ private:
+  std::ofstream _csv;
+
+  void row(const char* cont, const char* op, size_t n, const char* impl,
+           size_t reps, const bench::summary& s, const alloc_summary& a) {
+    this->_csv << cont << "," << op << "," << n << "," << impl << "," << reps
+               << "," << s.median << "," << s.p99 << "," << a.allocs_per_op
+               << "," << a.frees_per_op << "," << a.peak_bytes;
+    for (size_t i = 0; i < ft::alloc_stats::histogram_size; ++i) {
+      this->_csv << "," << a.histogram[i];
+    }
+    this->_csv << "\n";
+  }
+
+ public:
+  explicit report(const char* path) : _csv(path) {
+    this->_csv << std::fixed << std::setprecision(2);
+    this->_csv << "container,op,size,impl,reps,median_ns,p99_ns,"
+               << "allocs_per_op,frees_per_op,peak_bytes";
+    for (size_t i = 0; i < ft::alloc_stats::histogram_size; ++i) {
+      this->_csv << ",ops_with_" << i
+                 << (i + 1 == ft::alloc_stats::histogram_size ? "+" : "")
+                 << "_allocs";
+    }
+    this->_csv << "\n";
+    std::cout << std::left << std::setw(8) << "cont" << std::setw(12) << "op"
+              << std::right << "\tsize\tft med\tft p99\tstd med\tstd p99"
+              << "\tft/std\t(ns/op)\tft a/op\tstd a/op\tft peak\tstd peak"
+              << std::endl;
+  }
+
+  bool good() const { return (this->_csv.good()); }
+
+  void add(const char* cont, const char* op, size_t n, size_t reps,
+           const bench::summary& ft_s, const bench::summary& std_s,
+           const alloc_summary& ft_a, const alloc_summary& std_a) {
+    this->row(cont, op, n, "ft", reps, ft_s, ft_a);
+    this->row(cont, op, n, "std", reps, std_s, std_a);
+    std::cout << std::left << std::setw(8) << cont << std::setw(12) << op
+              << std::right << "\t" << n << std::fixed << std::setprecision(1)
+              << "\t" << ft_s.median << "\t" << ft_s.p99 << "\t"
+              << std_s.median << "\t" << std_s.p99 << "\t"
+              << std::setprecision(2)
+              << (std_s.median > 0 ? ft_s.median / std_s.median : 0)
+              << "\t\t" << ft_a.allocs_per_op << "\t" << std_a.allocs_per_op
+              << "\t\t" << ft_a.peak_bytes << "\t" << std_a.peak_bytes
+              << std::endl;
+  }
+};
+
+template < typename Op, typename Suite >
+bench::summary measure(const keys_type& keys, size_t reps, long& sum) {
+  typename Suite::container_type base;
+  std::vector< double > samples;
+
+  Suite::fill(base, keys);
+  // 첫 번째는 cache, allocator를 데우는 용도로 버린다.
+  Op::template run< Suite >(base, keys, sum);
+  for (size_t r = 0; r < reps; ++r) {
+    samples.push_back(Op::template run< Suite >(base, keys, sum));
+  }
+  return (bench::summarize(samples));
+}
+
+// Suite는 counting_allocator를 쓰는 container여야 한다.
+template < typename Op, typename Suite >
+alloc_summary count(const keys_type& keys, long& sum) {
+  ft::alloc_stats& stats = ft::default_alloc_stats();
+  alloc_summary a;
+
+  stats.reset();
+  {
+    typename Suite::container_type base;
+
+    Suite::fill(base, keys);
+    Op::template run< Suite >(base, keys, sum);
+  }
+  a.allocs_per_op =
+      stats.ops ? static_cast< double >(stats.op_allocations) / stats.ops : 0;
+  a.frees_per_op =
+      stats.ops ? static_cast< double >(stats.op_deallocations) / stats.ops
+                : 0;
+  a.peak_bytes = stats.op_peak_bytes;
+  for (size_t i = 0; i < ft::alloc_stats::histogram_size; ++i) {
+    a.histogram[i] = stats.histogram[i];
+  }
+  return (a);
+}
+
+template < typename Op, typename Family >
+void compare(report& out, const char* cont, const keys_type& keys,
+             long& sum) {
+  size_t reps = bench::repeats_for(keys.size());
+  bench::summary ft_s =
+      measure< Op, typename Family::ft_suite >(keys, reps, sum);
+  bench::summary std_s =
+      measure< Op, typename Family::std_suite >(keys, reps, sum);
+  alloc_summary ft_a = count< Op, typename Family::ft_counted >(keys, sum);
+  alloc_summary std_a = count< Op, typename Family::std_counted >(keys, sum);
+
+  out.add(cont, Op::name(), keys.size(), reps, ft_s, std_s, ft_a, std_a);
+}
+
+template < typename Family >
+void run_tree(report& out, const char* cont, const keys_type& keys,
+              long& sum) {
+  compare< insert_op, Family >(out, cont, keys, sum);
+  compare< find_op, Family >(out, cont, keys, sum);
+  compare< lower_bound_op, Family >(out, cont, keys, sum);
+  compare< erase_op, Family >(out, cont, keys, sum);
+  compare< iterate_op, Family >(out, cont, keys, sum);
+}
+
+// 0, 2, 4, ... , 2(n-1)을 섞은 것.
+keys_type make_keys(size_t n) {
+  keys_type keys(n);
+  bench::xorshift rng;
+
+  for (size_t i = 0; i < n; ++i) {
+    keys[i] = static_cast< int >(i * 2);
+  }
+  for (size_t i = n; i > 1; --i) {
+    std::swap(keys[i - 1], keys[rng.next() % i]);
+  }
+  return (keys);
+}
+
+// 사용법: suite [csv 경로] [최대 크기]
+int main(int argc, char** argv) {
+  const char* path = argc > 1 ? argv[1] : "bench_suite.csv";
+  const size_t max_size = bench::max_size_arg(argc - 1, argv + 1, 1000000);
+  long sum = 0;
+  report out(path);
+
+  if (!out.good()) {
+    std::cerr << "suite: cannot open " << path << std::endl;
+    return (1);
+  }
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    keys_type keys = make_keys(n);
+
+    compare< push_back_op, vector_family >(out, "vector", keys, sum);
+    compare< insert_op, vector_family >(out, "vector", keys, sum);
+    compare< erase_op, vector_family >(out, "vector", keys, sum);
+    run_tree< map_family >(out, "map", keys, sum);
+    run_tree< set_family >(out, "set", keys, sum);
+    compare< push_op, stack_family >(out, "stack", keys, sum);
+    compare< pop_op, stack_family >(out, "stack", keys, sum);
+  }
+  std::cout << "csv: " << path << std::endl;
+  bench::keep(sum);
+  return (0);
+}
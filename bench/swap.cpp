@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   swap.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "vector.hpp"
+
+/**
+ * 크기가 같고 마지막 element만 다른 두 container의 swap ns/op.
+ * (내용을 비교하면 매번 전체를 훑게 되는 경우)
+ */
+int main(int argc, char** argv) {
+  const size_t max_size = bench::max_size_arg(argc, argv, 10000000);
+  const size_t swaps = 1000;
+  long sum = 0;
+
+  std::cout << "size\tvector\tmap\t(ns/op)" << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    ft::vector< long > va(n, 1);
+    ft::vector< long > vb(n, 1);
+    vb.back() = 2;
+
+    bench::timer t;
+    for (size_t i = 0; i < swaps; ++i) {
+      va.swap(vb);
+    }
+    double vec = t.ns_per_op(swaps);
+    sum += va.back();
+
+    std::cout << n << std::fixed << std::setprecision(1) << "\t" << vec;
+
+    // map은 메모리 때문에 1e6 까지만.
+    if (n <= 1000000) {
+      ft::map< long, long > ma;
+      for (size_t i = 0; i < n; ++i) {
+        ma[static_cast< long >(i)] = 1;
+      }
+      ft::map< long, long > mb(ma);
+      mb.rbegin()->second = 2;
+
+      t.reset();
+      for (size_t i = 0; i < swaps; ++i) {
+        ma.swap(mb);
+      }
+      std::cout << "\t" << t.ns_per_op(swaps);
+      sum += ma.rbegin()->second;
+    }
+    std::cout << std::endl;
+  }
+  bench::keep(sum);
+  return (0);
+}
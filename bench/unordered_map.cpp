@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_map.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+#if __cplusplus >= 201103L
+#include <unordered_map>
+#endif
+
+#include "bench.hpp"
+#include "counting_allocator.hpp"
+#include "map.hpp"
+#include "unordered_map.hpp"
+#include "vector.hpp"
+
+/**
+ * map, unordered_map< int, int >의 insert / find / erase ns/op와
+ * element 하나당 byte. (counting_allocator로 잰 사용 중인 heap / size)
+ * 같은 무작위 key를 하나씩 insert 하고, find는 절반은 없는 key,
+ * erase는 넣은 순서대로 모두 지운다.
+ * C++11로 빌드하면 std::unordered_map도 같이 잰다. (make bench는 C++11)
+ */
+typedef ft::counting_allocator< ft::pair< const int, int > > counted;
+
+struct result {
+  double insert;
+  double find;
+  double erase;
+  double bytes;
+};
+
+template < typename Map >
+void measure(const ft::vector< int >& keys, size_t queries, long& sum,
+             result& r) {
+  Map mp;
+  bench::xorshift rng;
+  size_t n = keys.size();
+
+  bench::timer t_insert;
+  for (size_t i = 0; i < n; ++i) {
+    mp.insert(typename Map::value_type(keys[i], 1));
+  }
+  r.insert = t_insert.ns_per_op(n);
+
+  bench::timer t_find;
+  for (size_t i = 0; i < queries; ++i) {
+    typename Map::const_iterator it =
+        mp.find(static_cast< int >(rng.next() % (n * 2)));
+    if (it != mp.end()) sum += it->second;
+  }
+  r.find = t_find.ns_per_op(queries);
+
+  bench::timer t_erase;
+  for (size_t i = 0; i < n; ++i) {
+    sum += mp.erase(keys[i]);
+  }
+  r.erase = t_erase.ns_per_op(n);
+}
+
+template < typename Map >
+double bytes_per_entry(const ft::vector< int >& keys, Map& mp,
+                       ft::alloc_stats& stats) {
+  for (size_t i = 0; i < keys.size(); ++i) {
+    mp.insert(typename Map::value_type(keys[i], 1));
+  }
+  return (static_cast< double >(stats.bytes_in_use) / mp.size());
+}
+
+void print(const result& r) {
+  std::cout << std::fixed << std::setprecision(1) << "\t" << r.insert << "\t"
+            << r.find << "\t" << r.erase << "\t" << r.bytes;
+}
+
+int main(int argc, char** argv) {
+  const size_t max_size = bench::max_size_arg(argc, argv, 1000000);
+  const size_t queries = 1000000;
+  ft::vector< int > keys;
+  long sum = 0;
+
+  std::cout << "size\tname\tinsert\tfind\terase (ns/op)\tbytes/entry"
+            << std::endl;
+  for (size_t n = 1000; n <= max_size; n *= 10) {
+    bench::xorshift rng;
+    result r;
+
+    // 0 ~ 2n 중 짝수만 넣어서 홀수 key는 항상 없게 한다.
+    keys.clear();
+    for (size_t i = 0; i < n; ++i) {
+      keys.push_back(static_cast< int >(rng.next() % n) * 2);
+    }
+
+    {
+      ft::alloc_stats stats;
+      ft::map< int, int, ft::less< int >, counted > mp((ft::less< int >()),
+                                                        counted(stats));
+
+      measure< ft::map< int, int > >(keys, queries, sum, r);
+      r.bytes = bytes_per_entry(keys, mp, stats);
+      std::cout << n << "\tft::map";
+      print(r);
+      std::cout << std::endl;
+    }
+    {
+      ft::alloc_stats stats;
+      ft::unordered_map< int, int, ft::hash< int >, ft::equal_to< int >,
+                         counted >
+          mp(0, ft::hash< int >(), ft::equal_to< int >(), counted(stats));
+
+      measure< ft::unordered_map< int, int > >(keys, queries, sum, r);
+      r.bytes = bytes_per_entry(keys, mp, stats);
+      std::cout << n << "\tft::unordered_map";
+      print(r);
+      std::cout << std::endl;
+    }
+#if __cplusplus >= 201103L
+    {
+      typedef ft::counting_allocator< std::pair< const int, int > > std_counted;
+      ft::alloc_stats stats;
+      std::unordered_map< int, int, std::hash< int >, std::equal_to< int >,
+                          std_counted >
+          mp(0, std::hash< int >(), std::equal_to< int >(),
+             std_counted(stats));
+
+      measure< std::unordered_map< int, int > >(keys, queries, sum, r);
+      r.bytes = bytes_per_entry(keys, mp, stats);
+      std::cout << n << "\tstd::unordered_map";
+      print(r);
+      std::cout << std::endl;
+    }
+#endif
+  }
+  bench::keep(sum);
+  return (0);
+}
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_growth.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+/**
+ * push_back만 하는 buffer에서 growth policy별 비용.
+ * peak은 reallocation 순간에 old + new buffer가 같이 잡혀 있는 최대 byte,
+ * final은 다 넣은 뒤의 capacity byte. (MiB)
+ */
+template < typename Growth >
+void run(const char* name, size_t n, long& sum) {
+  typedef ft::vector< long, std::allocator< long >, Growth > vector_type;
+  vector_type v;
+  size_t prev = 0;
+  size_t peak = 0;
+  size_t reallocs = 0;
+
+  bench::timer t;
+  for (size_t i = 0; i < n; ++i) {
+    v.push_back(static_cast< long >(i));
+    if (v.capacity() != prev) {
+      if (prev + v.capacity() > peak) {
+        peak = prev + v.capacity();
+      }
+      prev = v.capacity();
+      ++reallocs;
+    }
+  }
+  double push = t.ns_per_op(n);
+  const double mib = 1024.0 * 1024.0 / sizeof(long);
+
+  sum += v.size();
+  std::cout << n << "\t" << name << "\t" << std::fixed << std::setprecision(2)
+            << push << "\t" << reallocs << "\t" << peak / mib << "\t"
+            << v.capacity() / mib << std::endl;
+}
+
+int main(int argc, char** argv) {
+  const size_t max_size = bench::max_size_arg(argc, argv, 10000000);
+  long sum = 0;
+
+  std::cout << "size\tpolicy\tns/op\trealloc\tpeak\tfinal\t(MiB)" << std::endl;
+  for (size_t n = 10000; n <= max_size; n *= 10) {
+    // 10의 거듭제곱은 2배, 1.5배 어느 쪽 경계와도 맞지 않도록 조금 늘린다.
+    size_t size = n + n / 3;
+
+    run< ft::growth_double >("2x", size, sum);
+    run< ft::growth_golden >("1.5x", size, sum);
+    run< ft::growth_page_aligned<> >("page", size, sum);
+  }
+  bench::keep(sum);
+  return (0);
+}
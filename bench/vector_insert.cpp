@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_insert.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+/**
+ * 큰 vector의 중간에 batch 단위로 넣고 지우는 비용. (ns/element)
+ * fill: insert(position, n, val), range: insert(position, first, last)
+ */
+template < typename T >
+void run(const char* name, size_t n, const T& val, long& sum) {
+  const size_t batch = 1000;
+  const size_t rounds = 20;
+  ft::vector< T > v(n, val);
+  ft::vector< T > src(batch, val);
+  bench::xorshift rng;
+
+  bench::timer t;
+  for (size_t i = 0; i < rounds; ++i) {
+    v.insert(v.begin() + rng.next() % v.size(), batch, val);
+  }
+  double fill = t.ns_per_op(rounds * batch);
+
+  t.reset();
+  for (size_t i = 0; i < rounds; ++i) {
+    v.insert(v.begin() + rng.next() % v.size(), src.begin(), src.end());
+  }
+  double range = t.ns_per_op(rounds * batch);
+
+  t.reset();
+  for (size_t i = 0; i < rounds * 2; ++i) {
+    size_t pos = rng.next() % (v.size() - batch);
+    v.erase(v.begin() + pos, v.begin() + pos + batch);
+  }
+  double erase = t.ns_per_op(rounds * 2 * batch);
+
+  sum += v.size();
+  std::cout << n << "\t" << name << "\t" << std::fixed << std::setprecision(1)
+            << fill << "\t" << range << "\t" << erase << std::endl;
+}
+
+int main(int argc, char** argv) {
+  const size_t max_size = bench::max_size_arg(argc, argv, 1000000);
+  long sum = 0;
+
+  std::cout << "size\ttype\tfill\trange\terase\t(ns/elem)" << std::endl;
+  for (size_t n = 10000; n <= max_size; n *= 10) {
+    run< int >("int", n, 42, sum);
+    run< std::string >("string", n, std::string(32, 'x'), sum);
+  }
+  bench::keep(sum);
+  return (0);
+}
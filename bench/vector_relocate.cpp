@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_relocate.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+/**
+ * element를 옮기는 비용. (reallocation, 앞쪽 insert / erase)
+ * int, POD struct는 memcpy / memmove 경로, std::string은 element 단위 경로.
+ */
+struct point {
+  double x;
+  double y;
+  long id;
+};
+
+template < typename T >
+T make(size_t i);
+
+template <>
+int make< int >(size_t i) {
+  return (static_cast< int >(i));
+}
+
+template <>
+point make< point >(size_t i) {
+  point p = {1.0, 2.0, static_cast< long >(i)};
+  return (p);
+}
+
+template <>
+std::string make< std::string >(size_t i) {
+  return (std::string(i % 8 + 1, 'a'));
+}
+
+template < typename T >
+void run(const char* name, size_t n, long& sum) {
+  ft::vector< T > v;
+  const T val = make< T >(n);
+  const size_t front_ops = 2000;
+
+  // push_back만으로 n까지. (capacity가 찰 때마다 reallocation)
+  bench::timer t;
+  for (size_t i = 0; i < n; ++i) {
+    v.push_back(val);
+  }
+  double push = t.ns_per_op(n);
+
+  // 앞쪽에 넣고 빼면 매번 전체를 한 칸씩 옮긴다.
+  t.reset();
+  for (size_t i = 0; i < front_ops; ++i) {
+    v.insert(v.begin(), val);
+    v.erase(v.begin());
+  }
+  double front = t.ns_per_op(front_ops * 2);
+
+  t.reset();
+  for (size_t i = 0; i < 10; ++i) {
+    ft::vector< T > copy(v);
+    sum += copy.size();
+  }
+  double copy = t.ns_per_op(10 * n);
+
+  sum += v.size();
+  std::cout << n << "\t" << name << "\t" << std::fixed << std::setprecision(2)
+            << push << "\t\t" << front << "\t\t" << copy << std::endl;
+}
+
+int main(int argc, char** argv) {
+  const size_t max_size = bench::max_size_arg(argc, argv, 1000000);
+  long sum = 0;
+
+  std::cout << "size\ttype\tpush_back\tfront ins/era\tcopy\t(ns/op)"
+            << std::endl;
+  for (size_t n = 10000; n <= max_size; n *= 10) {
+    run< int >("int", n, sum);
+    run< point >("point", n, sum);
+    run< std::string >("string", n, sum);
+  }
+  bench::keep(sum);
+  return (0);
+}
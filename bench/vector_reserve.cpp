@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_reserve.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+/**
+ * reserve로 capacity를 늘릴 때 element 하나를 옮기는 비용.
+ * 새 buffer에 다 만든 뒤 기존 것을 destroy 하는 방식(strong guarantee)이
+ * element마다 construct + destroy 하던 방식보다 느리지 않은지 본다.
+ * int, POD struct는 memcpy 경로, std::string은 element 단위 경로.
+ */
+struct point {
+  double x;
+  double y;
+  long id;
+};
+
+template < typename T >
+T make(size_t i);
+
+template <>
+int make< int >(size_t i) {
+  return (static_cast< int >(i));
+}
+
+template <>
+point make< point >(size_t i) {
+  point p = {1.0, 2.0, static_cast< long >(i)};
+  return (p);
+}
+
+template <>
+std::string make< std::string >(size_t i) {
+  return (std::string(i % 8 + 1, 'a'));
+}
+
+template < typename T >
+void run(const char* name, size_t n, long& sum) {
+  const int rounds = 10;
+  double total = 0;
+
+  for (int r = 0; r < rounds; ++r) {
+    ft::vector< T > v(n, make< T >(n));
+
+    // capacity == size인 상태에서 2배로.
+    bench::timer t;
+    v.reserve(n * 2);
+    total += t.ns_per_op(n);
+    sum += v.capacity();
+  }
+  std::cout << n << "\t" << name << "\t" << std::fixed << std::setprecision(3)
+            << total / rounds << std::endl;
+}
+
+int main(int argc, char** argv) {
+  const size_t max_size = bench::max_size_arg(argc, argv, 1000000);
+  long sum = 0;
+
+  std::cout << "size\ttype\treserve (ns/elem)" << std::endl;
+  for (size_t n = 10000; n <= max_size; n *= 10) {
+    run< int >("int", n, sum);
+    run< point >("point", n, sum);
+    run< std::string >("string", n, sum);
+  }
+  bench::keep(sum);
+  return (0);
+}
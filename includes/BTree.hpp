@@ -0,0 +1,761 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   BTree.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(BTREE_HPP)
+#define BTREE_HPP
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <memory>
+
+#include "BTreeNode.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft {
+// btree_set이 value 자리에 넣는 빈 type.
+struct btree_no_value {};
+
+/**
+ * btree_map, btree_set이 쓰는 B+ tree.
+ * element는 모두 leaf에 key 순서로 들어있고, inner 노드는 탐색용 key만
+ * 갖는다. 노드 하나에 element 여러 개를 연속으로 담으므로 RB_Tree보다
+ * 할당 수, 노드당 포인터, 탐색 중 cache miss가 적다.
+ * 노드 크기는 NodeBytes로 정한다. (btree_traits 참고)
+ *
+ * 노드 안에서 element를 미는 일은 vector와 같은 vector_ops로 한다.
+ * 항상 leaf 하나는 있다. (비어있으면 root leaf 하나)
+ * 노드 할당이 실패하면 tree는 insert 전 그대로다. split / merge 중에
+ * Key, T의 복사가 예외를 던지는 경우는 다루지 않는다.
+ */
+template < typename Key, typename T, typename Compare, typename Alloc,
+           size_t NodeBytes >
+class BTree {
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef Compare key_compare;
+  typedef size_t size_type;
+  typedef ft::btree_traits< Key, T, NodeBytes > traits;
+  typedef ft::BTreeNodeBase node_base;
+  typedef ft::BTreeLeaf< Key, T, traits::leaf_slots > leaf_type;
+  typedef ft::BTreeInner< Key, traits::inner_slots > inner_type;
+
+  // leaf 안의 자리. 탐색 결과와 iterator가 이걸 주고받는다.
+  struct position {
+    leaf_type* leaf;
+    size_type slot;
+
+    position(leaf_type* l, size_type s) : leaf(l), slot(s) {}
+    bool operator==(const position& x) const {
+      return (this->leaf == x.leaf && this->slot == x.slot);
+    }
+    bool operator!=(const position& x) const { return (!(*this == x)); }
+  };
+
+ private:
+  typedef typename Alloc::template rebind< key_type >::other key_alloc_type;
+  typedef typename Alloc::template rebind< mapped_type >::other
+      mapped_alloc_type;
+  typedef typename Alloc::template rebind< leaf_type >::other leaf_alloc_type;
+  typedef
+      typename Alloc::template rebind< inner_type >::other inner_alloc_type;
+  typedef ft::vector< key_type, key_alloc_type > key_vector;
+
+  typedef ft::relocator<
+      ft::is_trivially_copyable< Key >::value &&
+      ft::is_default_allocator< key_alloc_type, Key >::value >
+      key_relocator;
+  typedef ft::destroyer<
+      ft::is_trivially_destructible< Key >::value &&
+      ft::is_default_allocator< key_alloc_type, Key >::value >
+      key_destroyer;
+  typedef ft::vector_ops< key_relocator, key_destroyer > key_ops;
+  typedef ft::relocator<
+      ft::is_trivially_copyable< T >::value &&
+      ft::is_default_allocator< mapped_alloc_type, T >::value >
+      mapped_relocator;
+  typedef ft::destroyer<
+      ft::is_trivially_destructible< T >::value &&
+      ft::is_default_allocator< mapped_alloc_type, T >::value >
+      mapped_destroyer;
+  typedef ft::vector_ops< mapped_relocator, mapped_destroyer > mapped_ops;
+
+  // split 전에 미리 받아두는 inner 노드. (높이는 size_type의 bit 수 이하)
+  struct spare_nodes {
+    inner_type* nodes[sizeof(size_type) * CHAR_BIT];
+    size_type count;
+
+    spare_nodes() : count(0) {}
+    inner_type* pop() { return (this->nodes[--this->count]); }
+  };
+
+  node_base* _root;
+  leaf_type* _head;
+  leaf_type* _tail;
+  size_type _size;
+  key_compare _comp;
+  key_alloc_type _key_alloc;
+  mapped_alloc_type _mapped_alloc;
+  leaf_alloc_type _leaf_alloc;
+  inner_alloc_type _inner_alloc;
+
+ public:
+  BTree(const key_compare& comp, const Alloc& alloc)
+      : _root(NULL),
+        _head(NULL),
+        _tail(NULL),
+        _size(0),
+        _comp(comp),
+        _key_alloc(alloc),
+        _mapped_alloc(alloc),
+        _leaf_alloc(alloc),
+        _inner_alloc(alloc) {
+    this->reset(this->new_leaf());
+  }
+
+  // x의 element를 순서대로 뒤에 붙인다. (비교 없이 O(n))
+  BTree(const BTree& x)
+      : _root(NULL),
+        _head(NULL),
+        _tail(NULL),
+        _size(0),
+        _comp(x._comp),
+        _key_alloc(x._key_alloc),
+        _mapped_alloc(x._mapped_alloc),
+        _leaf_alloc(x._leaf_alloc),
+        _inner_alloc(x._inner_alloc) {
+    this->reset(this->new_leaf());
+    try {
+      for (leaf_type* leaf = x._head; leaf != NULL; leaf = leaf->next) {
+        for (size_type i = 0; i < leaf->count; ++i) {
+          this->append(leaf->keys()[i], leaf->values()[i]);
+        }
+      }
+    } catch (...) {
+      this->destroy_subtree(this->_root, NULL);
+      throw;
+    }
+  }
+
+  ~BTree() { this->destroy_subtree(this->_root, NULL); }
+
+  BTree& operator=(const BTree& x) {
+    if (this != &x) {
+      BTree tmp(x);
+      this->swap(tmp);
+    }
+    return (*this);
+  }
+
+  position begin() const { return (position(this->_head, 0)); }
+  position end() const { return (position(this->_tail, this->_tail->count)); }
+
+  bool empty() const { return (this->_size == 0); }
+  size_type size() const { return (this->_size); }
+  size_type max_size() const {
+    return (std::min(_key_alloc.max_size(), _mapped_alloc.max_size()));
+  }
+  key_compare key_comp() const { return (this->_comp); }
+
+  // leaf 끝은 다음 leaf의 처음으로 바꾼다. (마지막 leaf면 end)
+  position normalize(position p) const {
+    if (p.slot == p.leaf->count && p.leaf->next != NULL) {
+      return (position(p.leaf->next, 0));
+    }
+    return (p);
+  }
+
+  position next(position p) const {
+    ++p.slot;
+    return (this->normalize(p));
+  }
+
+  /**
+   * k가 들어갈 leaf와 그 안의 lower_bound 자리.
+   * leaf 끝일 수도 있으므로 그대로 iterator로 쓰지 않고, is_key_at이나
+   * insert_at에 넘긴다.
+   */
+  template < typename K >
+  position search(const K& k) const {
+    leaf_type* leaf = this->find_leaf(k);
+    const key_type* keys = leaf->keys();
+    size_type slot =
+        std::lower_bound(keys, keys + leaf->count, k, this->_comp) - keys;
+
+    return (position(leaf, slot));
+  }
+
+  // search(k)의 결과 p 자리의 key가 k와 같은지.
+  template < typename K >
+  bool is_key_at(position p, const K& k) const {
+    return (p.slot != p.leaf->count &&
+            !this->_comp(k, p.leaf->keys()[p.slot]));
+  }
+
+  template < typename K >
+  position lower_bound(const K& k) const {
+    return (this->normalize(this->search(k)));
+  }
+
+  template < typename K >
+  position upper_bound(const K& k) const {
+    leaf_type* leaf = this->find_leaf(k);
+    const key_type* keys = leaf->keys();
+    size_type slot =
+        std::upper_bound(keys, keys + leaf->count, k, this->_comp) - keys;
+
+    return (this->normalize(position(leaf, slot)));
+  }
+
+  template < typename K >
+  position find(const K& k) const {
+    position p = this->search(k);
+    return (this->is_key_at(p, k) ? p : this->end());
+  }
+
+  /**
+   * hint 바로 앞이 k가 들어갈 자리면 hint를, 아니면 search(k)를 리턴한다.
+   * (앞 key < k <= hint의 key) 앞 key가 같은 leaf에 있을 때만 hint를 쓴다.
+   * leaf의 처음에 넣으면 parent의 key보다 작아질 수 있기 때문이다.
+   * end()를 hint로 정렬된 key를 넣으면 탐색 없이 뒤에 붙는다.
+   */
+  position hint_slot(position hint, const key_type& k) const {
+    const key_type* keys = hint.leaf->keys();
+
+    if (hint.slot != 0 && this->_comp(keys[hint.slot - 1], k) &&
+        (hint.slot == hint.leaf->count || !this->_comp(keys[hint.slot], k))) {
+      return (hint);
+    }
+    return (this->search(k));
+  }
+
+  /**
+   * search나 hint_slot으로 찾은 자리 p에 (k, v)를 넣고 그 자리를 리턴한다.
+   * leaf가 가득 차 있으면 반으로 나누고, parent에 새 leaf의 첫 key를
+   * 넣는다. (parent도 가득 차 있으면 위로 반복)
+   * 마지막 leaf의 끝에 넣는 경우는 나누지 않고 새 leaf를 뒤에 붙인다.
+   * 정렬된 순서로 넣을 때 노드가 반씩 비는 것을 막는다.
+   */
+  position insert_at(position p, const key_type& k, const mapped_type& v) {
+    if (p.leaf->count < traits::leaf_slots) {
+      this->leaf_insert(p.leaf, p.slot, k, v);
+      ++this->_size;
+      return (p);
+    }
+    return (this->split_insert(p.leaf, p.slot, k, v));
+  }
+
+  // k가 모든 key보다 클 때. (복사, 정렬된 insert)
+  void append(const key_type& k, const mapped_type& v) {
+    this->insert_at(this->end(), k, v);
+  }
+
+  /**
+   * p의 element를 지운다. leaf가 leaf_min보다 적어지면 옆 leaf에서 하나
+   * 빌리고, 옆 leaf도 여유가 없으면 합친다. 합쳐서 parent의 key가 줄면
+   * parent도 같은 방식으로 맞춘다. root에 child가 하나만 남으면 그
+   * child가 root가 된다.
+   */
+  void erase(position p) {
+    leaf_type* leaf = p.leaf;
+
+    this->leaf_erase(leaf, p.slot);
+    --this->_size;
+    if (leaf != this->_root && leaf->count < traits::leaf_min) {
+      this->rebalance_leaf(leaf);
+    }
+  }
+
+  template < typename K >
+  size_type erase_key(const K& k) {
+    position p = this->search(k);
+
+    if (!this->is_key_at(p, k)) return (0);
+    this->erase(p);
+    return (1);
+  }
+
+  /**
+   * [first, last)를 지운다. 지울 때마다 노드가 바뀌므로 개수를 먼저 세고,
+   * first의 key 이상인 첫 element를 그 수만큼 지운다.
+   */
+  void erase(position first, position last) {
+    if (first == this->begin() && last == this->end()) {
+      this->clear();
+      return;
+    }
+
+    size_type n = 0;
+    for (position p = first; p != last; p = this->next(p)) {
+      ++n;
+    }
+    if (n == 0) return;
+
+    key_type k(first.leaf->keys()[first.slot]);
+    while (n-- > 0) {
+      this->erase(this->lower_bound(k));
+    }
+  }
+
+  // 첫 leaf 하나만 남기고 모두 해제한다.
+  void clear() {
+    leaf_type* keep = this->_head;
+
+    this->destroy_subtree(this->_root, keep);
+    keep->parent = NULL;
+    keep->prev = NULL;
+    keep->next = NULL;
+    this->reset(keep);
+  }
+
+  void swap(BTree& x) {
+    std::swap(this->_root, x._root);
+    std::swap(this->_head, x._head);
+    std::swap(this->_tail, x._tail);
+    std::swap(this->_size, x._size);
+    std::swap(this->_comp, x._comp);
+    std::swap(this->_key_alloc, x._key_alloc);
+    std::swap(this->_mapped_alloc, x._mapped_alloc);
+    std::swap(this->_leaf_alloc, x._leaf_alloc);
+    std::swap(this->_inner_alloc, x._inner_alloc);
+  }
+
+ private:
+  void reset(leaf_type* leaf) {
+    this->_root = leaf;
+    this->_head = leaf;
+    this->_tail = leaf;
+    this->_size = 0;
+  }
+
+  leaf_type* new_leaf() {
+    leaf_type* leaf = _leaf_alloc.allocate(1);
+
+    leaf->parent = NULL;
+    leaf->count = 0;
+    leaf->is_leaf = true;
+    leaf->prev = NULL;
+    leaf->next = NULL;
+    return (leaf);
+  }
+
+  inner_type* new_inner() {
+    inner_type* inner = _inner_alloc.allocate(1);
+
+    inner->parent = NULL;
+    inner->count = 0;
+    inner->is_leaf = false;
+    return (inner);
+  }
+
+  // element를 모두 destroy 하고 노드를 해제한다. keep은 해제하지 않는다.
+  void destroy_subtree(node_base* node, leaf_type* keep) {
+    if (node->is_leaf) {
+      leaf_type* leaf = static_cast< leaf_type* >(node);
+
+      key_destroyer::destroy(_key_alloc, leaf->keys(),
+                             leaf->keys() + leaf->count);
+      mapped_destroyer::destroy(_mapped_alloc, leaf->values(),
+                                leaf->values() + leaf->count);
+      leaf->count = 0;
+      if (leaf != keep) _leaf_alloc.deallocate(leaf, 1);
+      return;
+    }
+
+    inner_type* inner = static_cast< inner_type* >(node);
+    for (size_type i = 0; i <= inner->count; ++i) {
+      this->destroy_subtree(inner->children[i], keep);
+    }
+    key_destroyer::destroy(_key_alloc, inner->keys(),
+                           inner->keys() + inner->count);
+    _inner_alloc.deallocate(inner, 1);
+  }
+
+  // root에서 k가 있을 leaf까지 내려간다. (keys[i] <= k인 가장 오른쪽 child)
+  template < typename K >
+  leaf_type* find_leaf(const K& k) const {
+    node_base* node = this->_root;
+
+    while (!node->is_leaf) {
+      inner_type* inner = static_cast< inner_type* >(node);
+      const key_type* keys = inner->keys();
+
+      node = inner->children[std::upper_bound(keys, keys + inner->count, k,
+                                              this->_comp) -
+                             keys];
+    }
+    return (static_cast< leaf_type* >(node));
+  }
+
+  static size_type child_index(const inner_type* parent,
+                               const node_base* child) {
+    size_type i = 0;
+
+    while (parent->children[i] != child) ++i;
+    return (i);
+  }
+
+  // leaf에 자리가 있을 때 slot에 (k, v)를 넣는다.
+  // value 쪽에서 예외가 나면 key도 되돌린다.
+  void leaf_insert(leaf_type* leaf, size_type slot, const key_type& k,
+                   const mapped_type& v) {
+    key_type* keys = leaf->keys();
+    mapped_type* values = leaf->values();
+
+    key_ops::fill_insert(_key_alloc, keys + slot, keys + leaf->count,
+                         size_type(1), k);
+    try {
+      mapped_ops::fill_insert(_mapped_alloc, values + slot,
+                              values + leaf->count, size_type(1), v);
+    } catch (...) {
+      key_ops::erase(_key_alloc, keys + slot, keys + slot + 1,
+                     keys + leaf->count + 1);
+      throw;
+    }
+    ++leaf->count;
+  }
+
+  void leaf_erase(leaf_type* leaf, size_type slot) {
+    key_type* keys = leaf->keys();
+    mapped_type* values = leaf->values();
+
+    key_ops::erase(_key_alloc, keys + slot, keys + slot + 1,
+                   keys + leaf->count);
+    mapped_ops::erase(_mapped_alloc, values + slot, values + slot + 1,
+                      values + leaf->count);
+    --leaf->count;
+  }
+
+  // src의 [from, count)를 dst의 끝으로 옮긴다.
+  void leaf_move_tail(leaf_type* dst, leaf_type* src, size_type from) {
+    size_type n = src->count - from;
+    key_type* keys = dst->keys() + dst->count;
+
+    key_relocator::copy(_key_alloc, src->keys() + from,
+                        src->keys() + src->count, keys);
+    try {
+      mapped_relocator::copy(_mapped_alloc, src->values() + from,
+                             src->values() + src->count,
+                             dst->values() + dst->count);
+    } catch (...) {
+      key_destroyer::destroy(_key_alloc, keys, keys + n);
+      throw;
+    }
+    key_destroyer::destroy(_key_alloc, src->keys() + from,
+                           src->keys() + src->count);
+    mapped_destroyer::destroy(_mapped_alloc, src->values() + from,
+                              src->values() + src->count);
+    dst->count += n;
+    src->count = from;
+  }
+
+  // leaf가 나뉘면서 새로 필요한 inner 노드를 미리 받아둔다.
+  void reserve_spares(leaf_type* leaf, spare_nodes& spare) {
+    size_type need = 0;
+    node_base* node = leaf->parent;
+
+    for (; node != NULL && node->count == traits::inner_slots;
+         node = node->parent) {
+      ++need;
+    }
+    if (node == NULL) ++need;
+    try {
+      for (; spare.count < need; ++spare.count) {
+        spare.nodes[spare.count] = this->new_inner();
+      }
+    } catch (...) {
+      this->release_spares(spare);
+      throw;
+    }
+  }
+
+  void release_spares(spare_nodes& spare) {
+    while (spare.count > 0) {
+      _inner_alloc.deallocate(spare.pop(), 1);
+    }
+  }
+
+  position split_insert(leaf_type* leaf, size_type slot, const key_type& k,
+                        const mapped_type& v) {
+    bool append = (leaf == this->_tail && slot == leaf->count);
+    size_type mid = append ? leaf->count : leaf->count / 2;
+    spare_nodes spare;
+    leaf_type* right;
+
+    this->reserve_spares(leaf, spare);
+    try {
+      right = this->new_leaf();
+    } catch (...) {
+      this->release_spares(spare);
+      throw;
+    }
+    try {
+      if (append) {
+        this->leaf_insert(right, 0, k, v);
+      } else {
+        this->leaf_move_tail(right, leaf, mid);
+      }
+    } catch (...) {
+      _leaf_alloc.deallocate(right, 1);
+      this->release_spares(spare);
+      throw;
+    }
+
+    right->prev = leaf;
+    right->next = leaf->next;
+    if (leaf->next != NULL) {
+      leaf->next->prev = right;
+    } else {
+      this->_tail = right;
+    }
+    leaf->next = right;
+    this->insert_into_parent(leaf, right->keys()[0], right, spare, append);
+    this->release_spares(spare);
+
+    if (append) {
+      ++this->_size;
+      return (position(right, 0));
+    }
+    // 새 element는 원래 leaf의 끝에 붙을 수는 있지만 right의 처음에는
+    // 들어갈 수 없다. (right의 첫 key가 parent에 올라갔으므로)
+    position p = (slot <= mid) ? position(leaf, slot)
+                               : position(right, slot - mid);
+    this->leaf_insert(p.leaf, p.slot, k, v);
+    ++this->_size;
+    return (p);
+  }
+
+  // left 바로 오른쪽에 right를 child로 넣고 그 사이 key로 sep을 넣는다.
+  void insert_into_parent(node_base* left, const key_type& sep,
+                          node_base* right, spare_nodes& spare, bool append) {
+    inner_type* parent = static_cast< inner_type* >(left->parent);
+
+    if (parent == NULL) {
+      inner_type* root = spare.pop();
+
+      _key_alloc.construct(root->keys(), sep);
+      root->count = 1;
+      root->children[0] = left;
+      root->children[1] = right;
+      left->parent = root;
+      right->parent = root;
+      this->_root = root;
+      return;
+    }
+
+    size_type i = this->child_index(parent, left);
+    if (parent->count < traits::inner_slots) {
+      this->inner_insert(parent, i, sep, right);
+      return;
+    }
+
+    inner_type* sibling = spare.pop();
+    key_type up = this->split_inner(parent, i, sep, right, sibling, append);
+    this->insert_into_parent(parent, up, sibling, spare, append);
+  }
+
+  // key i 자리에 sep, child i + 1 자리에 right를 넣는다.
+  void inner_insert(inner_type* node, size_type i, const key_type& sep,
+                    node_base* right) {
+    key_type* keys = node->keys();
+
+    key_ops::fill_insert(_key_alloc, keys + i, keys + node->count,
+                         size_type(1), sep);
+    for (size_type j = node->count + 1; j > i + 1; --j) {
+      node->children[j] = node->children[j - 1];
+    }
+    node->children[i + 1] = right;
+    right->parent = node;
+    ++node->count;
+  }
+
+  // key i와 child i + 1을 지운다.
+  void inner_erase(inner_type* node, size_type i) {
+    key_type* keys = node->keys();
+
+    key_ops::erase(_key_alloc, keys + i, keys + i + 1, keys + node->count);
+    for (size_type j = i + 1; j < node->count; ++j) {
+      node->children[j] = node->children[j + 1];
+    }
+    --node->count;
+  }
+
+  /**
+   * 가득 찬 node에 (sep, right)를 넣으면서 node와 sibling으로 나누고,
+   * 가운데 key를 리턴한다. (parent로 올라갈 key)
+   * append면 sibling에 key 하나만 남겨서 node를 가득 찬 채로 둔다.
+   * inner split은 leaf split의 1 / inner_slots 정도라 임시 배열을 쓴다.
+   */
+  key_type split_inner(inner_type* node, size_type i, const key_type& sep,
+                       node_base* right, inner_type* sibling, bool append) {
+    const size_type n = node->count;
+    node_base* children[traits::inner_slots + 2];
+    key_vector keys(this->_key_alloc);
+
+    keys.reserve(n + 1);
+    keys.insert(keys.end(), node->keys(), node->keys() + i);
+    keys.push_back(sep);
+    keys.insert(keys.end(), node->keys() + i, node->keys() + n);
+    for (size_type j = 0; j <= n; ++j) {
+      children[j + (j > i)] = node->children[j];
+    }
+    children[i + 1] = right;
+
+    size_type m = append ? n - 1 : n / 2;
+    key_type* sorted = keys.begin().base();
+
+    key_destroyer::destroy(_key_alloc, node->keys(), node->keys() + n);
+    key_relocator::copy(_key_alloc, sorted, sorted + m, node->keys());
+    node->count = m;
+    key_relocator::copy(_key_alloc, sorted + m + 1, sorted + n + 1,
+                        sibling->keys());
+    sibling->count = n - m;
+    for (size_type j = 0; j <= n + 1; ++j) {
+      inner_type* owner = (j <= m) ? node : sibling;
+
+      owner->children[(j <= m) ? j : j - m - 1] = children[j];
+      children[j]->parent = owner;
+    }
+    return (sorted[m]);
+  }
+
+  void rebalance_leaf(leaf_type* leaf) {
+    inner_type* parent = static_cast< inner_type* >(leaf->parent);
+    size_type i = this->child_index(parent, leaf);
+    leaf_type* left = NULL;
+    leaf_type* right = NULL;
+
+    if (i > 0) left = static_cast< leaf_type* >(parent->children[i - 1]);
+    if (i < parent->count) {
+      right = static_cast< leaf_type* >(parent->children[i + 1]);
+    }
+
+    if (left != NULL && left->count > traits::leaf_min) {
+      size_type last = left->count - 1;
+
+      this->leaf_insert(leaf, 0, left->keys()[last], left->values()[last]);
+      this->leaf_erase(left, last);
+      parent->keys()[i - 1] = leaf->keys()[0];
+    } else if (right != NULL && right->count > traits::leaf_min) {
+      this->leaf_insert(leaf, leaf->count, right->keys()[0],
+                        right->values()[0]);
+      this->leaf_erase(right, 0);
+      parent->keys()[i] = right->keys()[0];
+    } else if (left != NULL) {
+      this->merge_leaves(left, leaf, parent, i - 1);
+    } else {
+      this->merge_leaves(leaf, right, parent, i);
+    }
+  }
+
+  // right(parent의 child k + 1)를 left에 합치고 right를 해제한다.
+  void merge_leaves(leaf_type* left, leaf_type* right, inner_type* parent,
+                    size_type k) {
+    this->leaf_move_tail(left, right, 0);
+    left->next = right->next;
+    if (right->next != NULL) {
+      right->next->prev = left;
+    } else {
+      this->_tail = left;
+    }
+    _leaf_alloc.deallocate(right, 1);
+    this->inner_erase(parent, k);
+    this->fix_inner(parent);
+  }
+
+  void rebalance_inner(inner_type* node) {
+    inner_type* parent = static_cast< inner_type* >(node->parent);
+    size_type i = this->child_index(parent, node);
+    inner_type* left = NULL;
+    inner_type* right = NULL;
+
+    if (i > 0) left = static_cast< inner_type* >(parent->children[i - 1]);
+    if (i < parent->count) {
+      right = static_cast< inner_type* >(parent->children[i + 1]);
+    }
+
+    if (left != NULL && left->count > traits::inner_min) {
+      // parent의 key를 node 앞으로 내리고, left의 마지막 key를 올린다.
+      size_type last = left->count - 1;
+
+      key_ops::fill_insert(_key_alloc, node->keys(),
+                           node->keys() + node->count, size_type(1),
+                           parent->keys()[i - 1]);
+      for (size_type j = node->count + 1; j > 0; --j) {
+        node->children[j] = node->children[j - 1];
+      }
+      node->children[0] = left->children[last + 1];
+      node->children[0]->parent = node;
+      ++node->count;
+      parent->keys()[i - 1] = left->keys()[last];
+      key_destroyer::destroy(_key_alloc, left->keys() + last,
+                             left->keys() + last + 1);
+      --left->count;
+    } else if (right != NULL && right->count > traits::inner_min) {
+      // parent의 key를 node 끝으로 내리고, right의 첫 key를 올린다.
+      _key_alloc.construct(node->keys() + node->count, parent->keys()[i]);
+      node->children[node->count + 1] = right->children[0];
+      node->children[node->count + 1]->parent = node;
+      ++node->count;
+      parent->keys()[i] = right->keys()[0];
+      key_ops::erase(_key_alloc, right->keys(), right->keys() + 1,
+                     right->keys() + right->count);
+      for (size_type j = 0; j < right->count; ++j) {
+        right->children[j] = right->children[j + 1];
+      }
+      --right->count;
+    } else if (left != NULL) {
+      this->merge_inners(left, node, parent, i - 1);
+    } else {
+      this->merge_inners(node, right, parent, i);
+    }
+  }
+
+  // parent의 key k를 사이에 두고 right(child k + 1)를 left에 합친다.
+  void merge_inners(inner_type* left, inner_type* right, inner_type* parent,
+                    size_type k) {
+    key_type* keys = left->keys() + left->count;
+
+    _key_alloc.construct(keys, parent->keys()[k]);
+    key_relocator::copy(_key_alloc, right->keys(),
+                        right->keys() + right->count, keys + 1);
+    for (size_type j = 0; j <= right->count; ++j) {
+      left->children[left->count + 1 + j] = right->children[j];
+      right->children[j]->parent = left;
+    }
+    left->count += right->count + 1;
+    key_destroyer::destroy(_key_alloc, right->keys(),
+                           right->keys() + right->count);
+    _inner_alloc.deallocate(right, 1);
+    this->inner_erase(parent, k);
+    this->fix_inner(parent);
+  }
+
+  // child를 합쳐서 key가 줄어든 inner 노드를 맞춘다.
+  void fix_inner(inner_type* node) {
+    if (node == this->_root) {
+      if (node->count == 0) {
+        this->_root = node->children[0];
+        this->_root->parent = NULL;
+        _inner_alloc.deallocate(node, 1);
+      }
+      return;
+    }
+    if (node->count < traits::inner_min) this->rebalance_inner(node);
+  }
+};
+
+}  // namespace ft
+
+#endif  // BTREE_HPP
@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   BTreeIterator.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(BTREEITERATOR_HPP)
+#define BTREEITERATOR_HPP
+
+#include <cstddef>
+
+#include "FlatMapIterator.hpp"
+#include "iterator.hpp"
+#include "utils.hpp"
+
+namespace ft {
+/**
+ * (leaf, slot)으로 element를 가리키는 bidirectional iterator의 공통 부분.
+ * end()는 마지막 leaf의 (leaf, count)다. leaf 끝에 닿으면 다음 leaf의
+ * 처음으로 넘어가고, 다음 leaf가 없으면 그 자리(end)에 남는다.
+ * insert / erase 때 element가 노드 사이를 옮겨다니므로, 그 뒤에는 모든
+ * iterator가 무효가 된다.
+ */
+template < typename Leaf >
+class BTreeIteratorBase {
+ protected:
+  Leaf* _leaf;
+  size_t _slot;
+
+  BTreeIteratorBase(Leaf* leaf, size_t slot) : _leaf(leaf), _slot(slot) {}
+
+  void increment() {
+    if (++this->_slot == this->_leaf->count && this->_leaf->next) {
+      this->_leaf = this->_leaf->next;
+      this->_slot = 0;
+    }
+  }
+
+  void decrement() {
+    if (this->_slot == 0) {
+      this->_leaf = this->_leaf->prev;
+      this->_slot = this->_leaf->count;
+    }
+    --this->_slot;
+  }
+
+ public:
+  Leaf* leaf() const { return (this->_leaf); }
+  size_t slot() const { return (this->_slot); }
+};
+
+/**
+ * btree_map의 iterator. T가 const T면 const_iterator.
+ * key와 value가 leaf의 서로 다른 배열에 있으므로 flat_map과 같이
+ * flat_map_reference를 값으로 리턴한다.
+ */
+template < typename Key, typename T, typename Leaf >
+class BTreeIterator : public BTreeIteratorBase< Leaf > {
+ public:
+  typedef ft::pair< const Key, typename ft::remove_const< T >::type >
+      value_type;
+  typedef ft::flat_map_reference< Key, T > reference;
+  typedef ft::flat_map_reference< Key, T > pointer;
+  typedef ptrdiff_t difference_type;
+  typedef ft::bidirectional_iterator_tag iterator_category;
+
+  BTreeIterator(Leaf* leaf = u_nullptr, size_t slot = 0)
+      : BTreeIteratorBase< Leaf >(leaf, slot) {}
+
+  // iterator -> const_iterator (반대 방향은 막는다)
+  template < typename U >
+  BTreeIterator(
+      const BTreeIterator< Key, U, Leaf >& x,
+      typename ft::enable_if<
+          ft::is_same< U, typename ft::remove_const< T >::type >::value,
+          U >::type* = u_nullptr)
+      : BTreeIteratorBase< Leaf >(x.leaf(), x.slot()) {}
+
+  reference operator*() const {
+    return (reference(this->_leaf->keys()[this->_slot],
+                      this->_leaf->values()[this->_slot]));
+  }
+  pointer operator->() const { return (**this); }
+
+  BTreeIterator& operator++() {
+    this->increment();
+    return (*this);
+  }
+  BTreeIterator operator++(int) {
+    BTreeIterator tmp(*this);
+    this->increment();
+    return (tmp);
+  }
+  BTreeIterator& operator--() {
+    this->decrement();
+    return (*this);
+  }
+  BTreeIterator operator--(int) {
+    BTreeIterator tmp(*this);
+    this->decrement();
+    return (tmp);
+  }
+};
+
+template < typename Key, typename T1, typename T2, typename Leaf >
+bool operator==(const BTreeIterator< Key, T1, Leaf >& lhs,
+                const BTreeIterator< Key, T2, Leaf >& rhs) {
+  return (lhs.leaf() == rhs.leaf() && lhs.slot() == rhs.slot());
+}
+
+template < typename Key, typename T1, typename T2, typename Leaf >
+bool operator!=(const BTreeIterator< Key, T1, Leaf >& lhs,
+                const BTreeIterator< Key, T2, Leaf >& rhs) {
+  return (!(lhs == rhs));
+}
+
+// btree_set의 iterator. (iterator와 const_iterator가 같다)
+template < typename Key, typename Leaf >
+class BTreeSetIterator : public BTreeIteratorBase< Leaf > {
+ public:
+  typedef Key value_type;
+  typedef const Key& reference;
+  typedef const Key* pointer;
+  typedef ptrdiff_t difference_type;
+  typedef ft::bidirectional_iterator_tag iterator_category;
+
+  BTreeSetIterator(Leaf* leaf = u_nullptr, size_t slot = 0)
+      : BTreeIteratorBase< Leaf >(leaf, slot) {}
+
+  reference operator*() const { return (this->_leaf->keys()[this->_slot]); }
+  pointer operator->() const { return (&this->_leaf->keys()[this->_slot]); }
+
+  BTreeSetIterator& operator++() {
+    this->increment();
+    return (*this);
+  }
+  BTreeSetIterator operator++(int) {
+    BTreeSetIterator tmp(*this);
+    this->increment();
+    return (tmp);
+  }
+  BTreeSetIterator& operator--() {
+    this->decrement();
+    return (*this);
+  }
+  BTreeSetIterator operator--(int) {
+    BTreeSetIterator tmp(*this);
+    this->decrement();
+    return (tmp);
+  }
+
+  bool operator==(const BTreeSetIterator& x) const {
+    return (this->_leaf == x._leaf && this->_slot == x._slot);
+  }
+  bool operator!=(const BTreeSetIterator& x) const { return (!(*this == x)); }
+};
+
+}  // namespace ft
+
+#endif  // BTREEITERATOR_HPP
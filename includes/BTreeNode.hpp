@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   BTreeNode.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(BTREENODE_HPP)
+#define BTREENODE_HPP
+
+#include <cstddef>
+
+namespace ft {
+/**
+ * 노드 안에 element N개가 들어갈 자리.
+ * construct 하지 않은 메모리만 잡아두고, element는 BTree가 allocator로
+ * 그 자리에 construct / destroy 한다.
+ * (다른 멤버는 alignment를 맞추기 위한 것)
+ */
+template < typename T, size_t N >
+union btree_slots {
+  char bytes[N * sizeof(T)];
+  long double align_ld;
+  long long align_ll;
+  void* align_ptr;
+
+  T* data() { return (reinterpret_cast< T* >(this->bytes)); }
+  const T* data() const { return (reinterpret_cast< const T* >(this->bytes)); }
+};
+
+/**
+ * leaf와 inner 노드의 공통 부분.
+ * count는 leaf에서는 element 수, inner에서는 key 수다. (child는 count + 1개)
+ */
+struct BTreeNodeBase {
+  BTreeNodeBase* parent;
+  size_t count;
+  bool is_leaf;
+};
+
+/**
+ * element를 담는 노드. key 배열과 value 배열을 따로 둬서 탐색 중에는 key만
+ * cache에 올린다. leaf끼리는 key 순서로 prev / next가 이어져 있어서
+ * iterator는 tree를 오르내리지 않고 옆 leaf로 간다.
+ * 노드는 BTree가 메모리만 받아 필드를 직접 세팅한다.
+ */
+template < typename Key, typename T, size_t N >
+struct BTreeLeaf : public BTreeNodeBase {
+  BTreeLeaf* prev;
+  BTreeLeaf* next;
+  btree_slots< Key, N > key_slots;
+  btree_slots< T, N > value_slots;
+
+  Key* keys() { return (this->key_slots.data()); }
+  const Key* keys() const { return (this->key_slots.data()); }
+  T* values() { return (this->value_slots.data()); }
+  const T* values() const { return (this->value_slots.data()); }
+};
+
+/**
+ * 탐색용 노드. keys[i]는 children[i + 1] 쪽 sub-tree의 key 이상이고
+ * children[i] 쪽 sub-tree의 key보다 크다. (erase 후에는 keys[i]가 실제
+ * element에 없을 수도 있지만 이 관계는 유지된다)
+ */
+template < typename Key, size_t N >
+struct BTreeInner : public BTreeNodeBase {
+  BTreeNodeBase* children[N + 1];
+  btree_slots< Key, N > key_slots;
+
+  Key* keys() { return (this->key_slots.data()); }
+  const Key* keys() const { return (this->key_slots.data()); }
+};
+
+/**
+ * 노드 하나를 NodeBytes 안팎으로 맞추는 element 수.
+ * 너무 작으면 split / merge가 성립하지 않으므로 최소 4개.
+ * leaf_min, inner_min보다 적어지면 erase 때 옆 노드와 합치거나 빌린다.
+ */
+template < typename Key, typename T, size_t NodeBytes >
+struct btree_traits {
+  static const size_t leaf_header = sizeof(BTreeNodeBase) + 2 * sizeof(void*);
+  static const size_t inner_header = sizeof(BTreeNodeBase) + sizeof(void*);
+  static const size_t leaf_fit =
+      NodeBytes > leaf_header
+          ? (NodeBytes - leaf_header) / (sizeof(Key) + sizeof(T))
+          : 0;
+  static const size_t inner_fit =
+      NodeBytes > inner_header
+          ? (NodeBytes - inner_header) / (sizeof(Key) + sizeof(void*))
+          : 0;
+  static const size_t leaf_slots = leaf_fit < 4 ? 4 : leaf_fit;
+  static const size_t inner_slots = inner_fit < 4 ? 4 : inner_fit;
+  static const size_t leaf_min = leaf_slots / 2;
+  static const size_t inner_min = inner_slots / 2;
+};
+
+}  // namespace ft
+
+#endif  // BTREENODE_HPP
@@ -0,0 +1,194 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   FlatMapIterator.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(FLATMAPITERATOR_HPP)
+#define FLATMAPITERATOR_HPP
+
+#include "iterator.hpp"
+#include "utils.hpp"
+
+namespace ft {
+/**
+ * flat_map의 element 참조.
+ * flat_map은 key와 value를 따로 된 배열에 두므로 ft::pair가 메모리에 없다.
+ * 그래서 operator*는 두 배열의 element를 가리키는 reference 쌍을 리턴한다.
+ * it->first, it->second, (*it).second = x 는 map과 똑같이 쓸 수 있고,
+ * ft::pair< const Key, T >가 필요하면 변환해서 복사본을 만든다.
+ */
+template < typename Key, typename T >
+struct flat_map_reference {
+  const Key& first;
+  T& second;
+
+  flat_map_reference(const Key& k, T& v) : first(k), second(v) {}
+
+  template < typename U, typename V >
+  operator ft::pair< U, V >() const {
+    return (ft::pair< U, V >(this->first, this->second));
+  }
+
+  // iterator의 operator->가 이 객체를 리턴하므로 it->first가 되게 한다.
+  const flat_map_reference* operator->() const { return (this); }
+};
+
+// ft::pair와 같은 비교. (flat_map의 ==, < 에서 ft::equal 등이 쓴다)
+template < typename Key, typename T1, typename T2 >
+bool operator==(const flat_map_reference< Key, T1 >& lhs,
+                const flat_map_reference< Key, T2 >& rhs) {
+  return (lhs.first == rhs.first && lhs.second == rhs.second);
+}
+
+template < typename Key, typename T1, typename T2 >
+bool operator<(const flat_map_reference< Key, T1 >& lhs,
+               const flat_map_reference< Key, T2 >& rhs) {
+  return (lhs.first < rhs.first ||
+          (!(rhs.first < lhs.first) && lhs.second < rhs.second));
+}
+
+/**
+ * key 배열과 value 배열의 같은 index를 같이 가리키는 random access
+ * iterator. T가 const T면 const_iterator.
+ * reference와 pointer는 모두 flat_map_reference다. (값으로 리턴됨)
+ */
+template < typename Key, typename T >
+class FlatMapIterator {
+ public:
+  typedef ft::pair< const Key, typename ft::remove_const< T >::type >
+      value_type;
+  typedef ft::flat_map_reference< Key, T > reference;
+  typedef ft::flat_map_reference< Key, T > pointer;
+  typedef ptrdiff_t difference_type;
+  typedef ft::random_access_iterator_tag iterator_category;
+
+ protected:
+  const Key* _key;
+  T* _value;
+
+ public:
+  FlatMapIterator(const Key* key = u_nullptr, T* value = u_nullptr)
+      : _key(key), _value(value) {}
+
+  // iterator -> const_iterator
+  template < typename U >
+  FlatMapIterator(const FlatMapIterator< Key, U >& other)
+      : _key(other.key_base()), _value(other.value_base()) {}
+
+  const Key* key_base() const { return (this->_key); }
+  T* value_base() const { return (this->_value); }
+
+  reference operator*() const {
+    return (reference(*this->_key, *this->_value));
+  }
+
+  pointer operator->() const { return (operator*()); }
+
+  FlatMapIterator& operator++() {
+    ++this->_key;
+    ++this->_value;
+    return (*this);
+  }
+
+  FlatMapIterator operator++(int) {
+    FlatMapIterator tmp = *this;
+    ++*this;
+    return (tmp);
+  }
+
+  FlatMapIterator& operator--() {
+    --this->_key;
+    --this->_value;
+    return (*this);
+  }
+
+  FlatMapIterator operator--(int) {
+    FlatMapIterator tmp = *this;
+    --*this;
+    return (tmp);
+  }
+
+  FlatMapIterator operator+(difference_type n) const {
+    return (FlatMapIterator(this->_key + n, this->_value + n));
+  }
+
+  FlatMapIterator operator-(difference_type n) const {
+    return (FlatMapIterator(this->_key - n, this->_value - n));
+  }
+
+  FlatMapIterator& operator+=(difference_type n) {
+    this->_key += n;
+    this->_value += n;
+    return (*this);
+  }
+
+  FlatMapIterator& operator-=(difference_type n) {
+    this->_key -= n;
+    this->_value -= n;
+    return (*this);
+  }
+
+  reference operator[](difference_type n) const { return (*(*this + n)); }
+};
+
+// 두 배열의 index는 항상 같이 움직이므로 비교는 key 쪽 pointer만 본다.
+template < class Key, class T >
+FlatMapIterator< Key, T > operator+(
+    typename FlatMapIterator< Key, T >::difference_type n,
+    const FlatMapIterator< Key, T >& it) {
+  return (it + n);
+}
+
+template < class Key, class T_L, class T_R >
+typename FlatMapIterator< Key, T_L >::difference_type operator-(
+    const FlatMapIterator< Key, T_L >& lhs,
+    const FlatMapIterator< Key, T_R >& rhs) {
+  return (lhs.key_base() - rhs.key_base());
+}
+
+template < class Key, class T_L, class T_R >
+bool operator==(const FlatMapIterator< Key, T_L >& lhs,
+                const FlatMapIterator< Key, T_R >& rhs) {
+  return (lhs.key_base() == rhs.key_base());
+}
+
+template < class Key, class T_L, class T_R >
+bool operator!=(const FlatMapIterator< Key, T_L >& lhs,
+                const FlatMapIterator< Key, T_R >& rhs) {
+  return (lhs.key_base() != rhs.key_base());
+}
+
+template < class Key, class T_L, class T_R >
+bool operator<(const FlatMapIterator< Key, T_L >& lhs,
+               const FlatMapIterator< Key, T_R >& rhs) {
+  return (lhs.key_base() < rhs.key_base());
+}
+
+template < class Key, class T_L, class T_R >
+bool operator>(const FlatMapIterator< Key, T_L >& lhs,
+               const FlatMapIterator< Key, T_R >& rhs) {
+  return (lhs.key_base() > rhs.key_base());
+}
+
+template < class Key, class T_L, class T_R >
+bool operator<=(const FlatMapIterator< Key, T_L >& lhs,
+                const FlatMapIterator< Key, T_R >& rhs) {
+  return (lhs.key_base() <= rhs.key_base());
+}
+
+template < class Key, class T_L, class T_R >
+bool operator>=(const FlatMapIterator< Key, T_L >& lhs,
+                const FlatMapIterator< Key, T_R >& rhs) {
+  return (lhs.key_base() >= rhs.key_base());
+}
+
+}  // namespace ft
+
+#endif  // FLATMAPITERATOR_HPP
@@ -0,0 +1,304 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   HashTable.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(HASHTABLE_HPP)
+#define HASHTABLE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+#include "hash.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft {
+/**
+ * unordered_map, unordered_set이 쓰는 open addressing hash table.
+ * key는 _keys에 넣은 순서대로 빈틈없이 있고, bucket 배열은 그 index만
+ * 갖는다. (Robin Hood hashing, linear probing)
+ *
+ * bucket에는 key의 hash 아래 32bit도 같이 둔다. 탐색 중에는 hash가 같을
+ * 때만 key를 비교하므로 없는 key를 찾을 때 key 배열을 거의 읽지 않는다.
+ * insert 중에는 원래 자리에서 덜 떨어진 element가 자리를 내주므로 (Robin
+ * Hood) 모든 element의 거리가 고르고, 탐색은 자기보다 덜 떨어진 element를
+ * 만나면 멈춘다. erase는 뒤쪽 element를 한 칸씩 당겨서 빈 자리를 메운다.
+ * (tombstone 없음)
+ *
+ * erase된 자리에는 마지막 element를 옮긴다. 그래서 iterator는 vector처럼
+ * 배열을 순서대로 돌고, insert / erase 후에는 무효가 된다. erase는 지운
+ * 자리를 리턴하며, 그 자리에는 아직 돌지 않은 element가 온다.
+ */
+template < typename Key, typename Hash, typename KeyEqual, typename Alloc >
+class HashTable {
+ public:
+  typedef Key key_type;
+  typedef Hash hasher;
+  typedef KeyEqual key_equal;
+  typedef size_t size_type;
+  typedef typename Alloc::template rebind< key_type >::other key_alloc_type;
+  typedef ft::vector< key_type, key_alloc_type > key_vector;
+
+ private:
+  // index가 npos_index면 빈 bucket.
+  struct bucket {
+    unsigned int index;
+    unsigned int hash;
+  };
+
+  typedef typename Alloc::template rebind< bucket >::other bucket_alloc_type;
+  typedef ft::vector< bucket, bucket_alloc_type > bucket_vector;
+  typedef typename Alloc::template rebind< unsigned int >::other
+      hash_alloc_type;
+  typedef ft::vector< unsigned int, hash_alloc_type > hash_vector;
+
+  static const unsigned int npos_index = ~0u;
+  static const size_type min_buckets = 8;
+
+  key_vector _keys;
+  hash_vector _hashes;  // _keys[i]의 hash
+  bucket_vector _buckets;
+  float _max_load;
+  hasher _hash;
+  key_equal _eq;
+
+ public:
+  HashTable(size_type bucket_count, const hasher& hf, const key_equal& eq,
+            const Alloc& alloc)
+      : _keys(key_alloc_type(alloc)),
+        _hashes(hash_alloc_type(alloc)),
+        _buckets(bucket_alloc_type(alloc)),
+        _max_load(0.875f),
+        _hash(hf),
+        _eq(eq) {
+    if (bucket_count > 0) this->rehash(bucket_count);
+  }
+
+  const key_vector& keys() const { return (_keys); }
+
+  bool empty() const { return (_keys.empty()); }
+  size_type size() const { return (_keys.size()); }
+  size_type max_size() const {
+    return (std::min(_keys.max_size(), static_cast< size_type >(npos_index)));
+  }
+
+  size_type bucket_count() const { return (_buckets.size()); }
+  float load_factor() const {
+    if (_buckets.empty()) return (0.0f);
+    return (static_cast< float >(this->size()) / _buckets.size());
+  }
+  float max_load_factor() const { return (_max_load); }
+
+  /**
+   * 빈 bucket이 있어야 탐색이 끝나므로 0.95 이하로 자른다.
+   * 지금 size가 넘치면 바로 bucket을 늘린다.
+   */
+  void max_load_factor(float ml) {
+    if (!(ml > 0.0f)) ml = 0.875f;
+    this->_max_load = std::min(ml, 0.95f);
+    this->rehash(0);
+  }
+
+  // bucket을 n개 이상, size가 max_load_factor를 넘지 않을 만큼으로 맞춘다.
+  void rehash(size_type n) {
+    size_type count = min_buckets;
+
+    while (count < n || !this->fits(this->size(), count)) count *= 2;
+    if (count != _buckets.size()) this->rebuild(count);
+  }
+
+  // n개까지 bucket과 key 배열을 다시 잡지 않게 한다.
+  void reserve(size_type n) {
+    if (!this->fits(n, _buckets.size())) this->rebuild(this->buckets_for(n));
+    _keys.reserve(n);
+    _hashes.reserve(n);
+  }
+
+  hasher hash_function() const { return (_hash); }
+  key_equal key_eq() const { return (_eq); }
+
+  unsigned int hash_of(const key_type& k) const {
+    return (static_cast< unsigned int >(ft::hash_mix(_hash(k))));
+  }
+
+  // k의 index. 없으면 size().
+  size_type find(const key_type& k) const {
+    return (this->find_hashed(k, this->hash_of(k)));
+  }
+
+  size_type find_hashed(const key_type& k, unsigned int h) const {
+    if (_buckets.empty()) return (this->size());
+
+    const bucket* b = _buckets.begin().base();
+    size_type mask = _buckets.size() - 1;
+
+    for (size_type pos = h & mask, dist = 0;; pos = (pos + 1) & mask, ++dist) {
+      if (b[pos].index == npos_index || ((pos - b[pos].hash) & mask) < dist) {
+        return (this->size());
+      }
+      if (b[pos].hash == h && _eq(_keys[b[pos].index], k)) {
+        return (b[pos].index);
+      }
+    }
+  }
+
+  // 없으면 끝에 넣는다. (index, insert 했는지) 리턴.
+  ft::pair< size_type, bool > insert(const key_type& k) {
+    unsigned int h = this->hash_of(k);
+    size_type i = this->find_hashed(k, h);
+
+    if (i != this->size()) return (ft::make_pair(i, false));
+    this->push_back(k, h);
+    return (ft::make_pair(i, true));
+  }
+
+  /**
+   * find_hashed로 없는 걸 확인한 k를 끝에 넣는다.
+   * bucket이 모자라면 먼저 늘린다. 예외가 나면 넣기 전 그대로다.
+   */
+  void push_back(const key_type& k, unsigned int h) {
+    size_type i = this->size();
+
+    if (!this->fits(i + 1, _buckets.size())) {
+      this->rebuild(this->buckets_for(i + 1));
+    }
+    _keys.push_back(k);
+    try {
+      _hashes.push_back(h);
+    } catch (...) {
+      _keys.pop_back();
+      throw;
+    }
+    this->place(_buckets, h, static_cast< unsigned int >(i));
+  }
+
+  // index i를 지우고 마지막 element를 그 자리로 옮긴다.
+  // 다음에 볼 element가 있는 i를 리턴한다. (마지막이었으면 size())
+  size_type erase(size_type i) {
+    size_type last = this->size() - 1;
+
+    this->remove_bucket(this->find_bucket(i));
+    if (i != last) {
+      _buckets[this->find_bucket(last)].index = static_cast< unsigned int >(i);
+      _keys[i] = _keys[last];
+      _hashes[i] = _hashes[last];
+    }
+    _keys.pop_back();
+    _hashes.pop_back();
+    return (i);
+  }
+
+  // bucket 수는 그대로 둔다.
+  void clear() {
+    _keys.clear();
+    _hashes.clear();
+    std::fill(_buckets.begin(), _buckets.end(), this->empty_bucket());
+  }
+
+  void swap(HashTable& x) {
+    _keys.swap(x._keys);
+    _hashes.swap(x._hashes);
+    _buckets.swap(x._buckets);
+    std::swap(this->_max_load, x._max_load);
+    std::swap(this->_hash, x._hash);
+    std::swap(this->_eq, x._eq);
+  }
+
+ private:
+  static bucket empty_bucket() {
+    bucket b;
+
+    b.index = npos_index;
+    b.hash = 0;
+    return (b);
+  }
+
+  bool fits(size_type n, size_type count) const {
+    return (static_cast< double >(n) <=
+            static_cast< double >(count) * this->_max_load);
+  }
+
+  size_type buckets_for(size_type n) const {
+    size_type count = min_buckets;
+
+    while (!this->fits(n, count)) count *= 2;
+    return (count);
+  }
+
+  // bucket 배열을 count개로 새로 만들고 모든 index를 다시 넣는다.
+  void rebuild(size_type count) {
+    bucket_vector buckets(count, this->empty_bucket(),
+                          _buckets.get_allocator());
+
+    for (size_type i = 0; i < this->size(); ++i) {
+      this->place(buckets, _hashes[i], static_cast< unsigned int >(i));
+    }
+    _buckets.swap(buckets);
+  }
+
+  /**
+   * 원래 자리(hash & mask)부터 빈 bucket을 찾아 넣는다.
+   * 가는 길에 자기보다 덜 떨어진 element를 만나면 그 자리를 뺏고,
+   * 밀려난 element로 계속 간다.
+   */
+  static void place(bucket_vector& buckets, unsigned int h,
+                    unsigned int index) {
+    bucket* b = buckets.begin().base();
+    size_type mask = buckets.size() - 1;
+    bucket cur;
+
+    cur.index = index;
+    cur.hash = h;
+    for (size_type pos = h & mask, dist = 0;; pos = (pos + 1) & mask, ++dist) {
+      if (b[pos].index == npos_index) {
+        b[pos] = cur;
+        return;
+      }
+      size_type resident = (pos - b[pos].hash) & mask;
+      if (resident < dist) {
+        std::swap(b[pos], cur);
+        dist = resident;
+      }
+    }
+  }
+
+  // index i를 가리키는 bucket의 위치.
+  size_type find_bucket(size_type i) const {
+    const bucket* b = _buckets.begin().base();
+    size_type mask = _buckets.size() - 1;
+    size_type pos = _hashes[i] & mask;
+
+    while (b[pos].index != i) pos = (pos + 1) & mask;
+    return (pos);
+  }
+
+  // pos를 비우고, 뒤에 원래 자리가 아닌 element들을 한 칸씩 당긴다.
+  void remove_bucket(size_type pos) {
+    bucket* b = _buckets.begin().base();
+    size_type mask = _buckets.size() - 1;
+
+    for (;;) {
+      size_type next = (pos + 1) & mask;
+
+      if (b[next].index == npos_index || ((next - b[next].hash) & mask) == 0) {
+        break;
+      }
+      b[pos] = b[next];
+      pos = next;
+    }
+    b[pos] = this->empty_bucket();
+  }
+};
+
+}  // namespace ft
+
+#endif  // HASHTABLE_HPP
@@ -13,13 +13,75 @@
 #if !defined(RB_TREE_HPP)
 #define RB_TREE_HPP
 
+#include <algorithm>
+#include <new>
+
 #include "RB_TreeIterator.hpp"
+#include "pool_allocator.hpp"
 #include "printTree.hpp"
 
 namespace ft {
 
+/**
+ * Ranked인 tree에서 노드의 count(sub-tree 크기)를 맞춰준다.
+ * 모양이 바뀌는 곳(노드를 달고 떼는 곳, 회전, 재구성, 위치 교환)에서 부른다.
+ * Ranked가 아니면 모두 빈 함수다.
+ */
+template < bool Ranked >
+struct RB_TreeCounter {
+  template < typename Node >
+  static void init(Node*, size_t) {}
+  template < typename Node >
+  static void update(Node*) {}
+  template < typename Node >
+  static void add_to_path(Node*, int) {}
+  template < typename Node >
+  static void copy(Node*, const Node*) {}
+  template < typename Node >
+  static void swap(Node*, Node*) {}
+};
+
+template <>
+struct RB_TreeCounter< true > {
+  template < typename Node >
+  static void init(Node* n, size_t count) {
+    n->count = count;
+  }
+
+  // 두 child의 count로 다시 계산한다. (n은 nil이 아님)
+  template < typename Node >
+  static void update(Node* n) {
+    n->count = n->leftChild->count + n->rightChild->count + 1;
+  }
+
+  // n부터 root까지의 count에 diff(+1 또는 -1)를 더한다.
+  template < typename Node >
+  static void add_to_path(Node* n, int diff) {
+    for (; !n->is_nil(); n = n->parent) {
+      n->count += diff;
+    }
+  }
+
+  template < typename Node >
+  static void copy(Node* dst, const Node* src) {
+    dst->count = src->count;
+  }
+
+  // 두 노드의 자리를 맞바꾼 뒤, count도 자리를 따라가게 한다.
+  template < typename Node >
+  static void swap(Node* a, Node* b) {
+    std::swap(a->count, b->count);
+  }
+};
+
+/**
+ * Ranked면 노드마다 sub-tree 크기를 유지해서 select(k번째 노드),
+ * rank(k보다 작은 노드 수), iterator 사이의 distance를 O(log n)에 한다.
+ * 대신 노드가 size_t 하나만큼 커지고, insert / erase 때 root까지의 경로를
+ * 한 번 더 갱신한다.
+ */
 template < typename T, typename Compare = ft::less< T >,
-           typename Alloc = std::allocator< T > >
+           typename Alloc = std::allocator< T >, bool Ranked = false >
 class RB_Tree {
  public:
   typedef T value_type;
@@ -27,96 +89,156 @@ class RB_Tree {
   typedef T& reference;
   typedef Compare value_comp;
   typedef Alloc alloc_type;
-  typedef ft::RB_TreeNode< T > node_type;
+  typedef ft::RB_TreeNode< T, Ranked > node_type;
   typedef typename Alloc::template rebind< node_type >::other node_alloc_type;
-  typedef ft::RB_TreeIterator< T, T*, T& > iterator;
-  typedef ft::RB_TreeIterator< T, const T*, const T& > const_iterator;
+  typedef
+      typename Alloc::template rebind< node_type* >::other node_ptr_alloc_type;
+  typedef ft::RB_TreeIterator< T, T*, T&, Ranked > iterator;
+  typedef ft::RB_TreeIterator< T, const T*, const T&, Ranked > const_iterator;
   typedef size_t size_type;
 
  private:
+  typedef ft::RB_TreeCounter< Ranked > counter;
+
   node_type* _root;
   node_type* _nil;
+  // 가장 작은 / 큰 노드. (비어있으면 nil)
+  // insert, erase 때 바로 갱신해서 begin(), --end()가 O(1)이다.
+  node_type* _leftmost;
+  node_type* _rightmost;
   size_type _size;
   value_comp _comp;
+  alloc_type _alloc;
   node_alloc_type _node_alloc;
 
  public:
-  RB_Tree()
+  explicit RB_Tree(const value_comp& comp = value_comp(),
+                   const alloc_type& alloc = alloc_type())
       : _root(NULL),
         _nil(NULL),
+        _leftmost(NULL),
+        _rightmost(NULL),
         _size(0),
-        _comp(value_comp()),
-        _node_alloc(node_alloc_type()) {
+        _comp(comp),
+        _alloc(alloc),
+        _node_alloc(alloc) {
     // nil로 루트 노드 세팅
     this->_nil = make_nil_node();
-    this->_nil->color = BLACK;
-    this->_nil->leftChild = this->_nil;
-    this->_nil->rightChild = this->_nil;
-    this->_nil->parent = this->_nil;
     this->_root = this->_nil;
+    this->_leftmost = this->_nil;
+    this->_rightmost = this->_nil;
   }
 
+  // node allocator는 ot의 node allocator를 복사하지 않고 value allocator에서
+  // 새로 만든다. (pool_allocator인 경우 ot와 pool을 공유하지 않기 위함)
   RB_Tree(const RB_Tree& ot)
       : _root(NULL),
         _nil(NULL),
+        _leftmost(NULL),
+        _rightmost(NULL),
         _size(0),
-        _comp(value_comp()),
-        _node_alloc(node_alloc_type()) {
+        _comp(ot._comp),
+        _alloc(ot._alloc),
+        _node_alloc(ot._alloc) {
     this->_nil = make_nil_node();
-    this->_nil->leftChild = this->_nil;
-    this->_nil->rightChild = this->_nil;
-    copy(ot);
-    this->_nil->parent = get_back_node();
+    this->_root = this->_nil;
+    this->_leftmost = this->_nil;
+    this->_rightmost = this->_nil;
+    try {
+      copy(ot);
+    } catch (...) {
+      ft::deallocate_outside_pool(_node_alloc, this->_nil);
+      throw;
+    }
+  }
+
+#if __cplusplus >= 201103L
+  /**
+   * ot의 노드와 nil을 그대로 가져온다. 할당하지 않으므로 noexcept.
+   * ot는 nil도 없는 빈 tree로 남고, 다음에 노드를 달 때 nil을 새로
+   * 만든다. (ensure_nil)
+   */
+  RB_Tree(RB_Tree&& ot) noexcept
+      : _root(ot._root),
+        _nil(ot._nil),
+        _leftmost(ot._leftmost),
+        _rightmost(ot._rightmost),
+        _size(ot._size),
+        _comp(ot._comp),
+        _alloc(ot._alloc),
+        _node_alloc(ot._node_alloc) {
+    ot._root = NULL;
+    ot._nil = NULL;
+    ot._leftmost = NULL;
+    ot._rightmost = NULL;
+    ot._size = 0;
   }
+#endif
 
   virtual ~RB_Tree() {
-    clear();
-    _node_alloc.destroy(this->_nil);
-    _node_alloc.deallocate(this->_nil, 1);
+    // move로 비워진 tree는 반환할 노드가 없다.
+    // (pool은 노드를 가져간 tree와 공유 중이므로 release 하면 안 된다)
+    if (this->_nil == NULL) {
+      return;
+    }
+    if (!release_nodes()) {
+      clear();
+    }
+    ft::deallocate_outside_pool(_node_alloc, this->_nil);
   }
 
   RB_Tree& operator=(const RB_Tree& x) {
     if (this != &x) {
+      this->_comp = x._comp;
+      ensure_nil();
       copy(x);
     }
     return (*this);
   }
 
+  // 노드는 그대로 두고 tree의 상태만 맞바꾼다. O(1)
+  // (node allocator도 같이 바꿔야 각자의 노드를 반환할 수 있다)
+  void swap(RB_Tree& x) {
+    std::swap(this->_root, x._root);
+    std::swap(this->_nil, x._nil);
+    std::swap(this->_leftmost, x._leftmost);
+    std::swap(this->_rightmost, x._rightmost);
+    std::swap(this->_size, x._size);
+    std::swap(this->_comp, x._comp);
+    std::swap(this->_alloc, x._alloc);
+    std::swap(this->_node_alloc, x._node_alloc);
+  }
+
   bool is_empty_tree() const { return (this->_size == 0); }
 
-  node_type* get_front_node() const {
-    node_type* res = this->_root;
+  size_type max_size() const { return (this->_node_alloc.max_size()); }
 
-    while (res->leftChild && !res->is_nil() && !res->leftChild->is_nil()) {
-      res = res->leftChild;
-    }
-    return (res);
-  }
+  node_type* get_front_node() const { return (this->_leftmost); }
 
   // 이 node를 nil의 parent로 설정.
-  node_type* get_back_node() const {
-    node_type* res = this->_root;
-
-    while (res->rightChild && !res->is_nil() && !res->rightChild->is_nil()) {
-      res = res->rightChild;
-    }
-    return (res);
-  }
+  node_type* get_back_node() const { return (this->_rightmost); }
 
   node_type* get_nil() const { return (this->_nil); }
 
-  node_type* search(value_type val) const {
+  /**
+   * k와 같은 노드를 찾는다. 없으면 nil.
+   * K는 value_type이 아니어도 된다. (_comp가 K와 value_type을 비교할 수
+   * 있으면 됨) map은 key만으로 탐색하므로 value_type을 만들지 않는다.
+   */
+  template < typename K >
+  node_type* search(const K& k) const {
     node_type* result = this->_root;
 
     if (is_empty_tree()) {
       return (this->_nil);
     }
-    while (!result->is_nil() &&
-           (_comp(val, *result->value) || _comp(*result->value, val))) {
-      if (_comp(val, *(result->value))) {
+    while (!result->is_nil()) {
+      if (_comp(k, result->value)) {
         result = result->leftChild;
-      } else {
+      } else if (_comp(result->value, k)) {
         result = result->rightChild;
+      } else {
+        break;
       }
     }
     return (result);
@@ -124,31 +246,187 @@ class RB_Tree {
 
   size_type size() const { return (this->_size); }
 
+  // in-order로 k번째(0부터) 노드. 없으면 nil. (Ranked인 경우만)
+  node_type* select(size_type k) const {
+    node_type* x = this->_root;
+
+    if (is_empty_tree()) {
+      return (this->_nil);
+    }
+    while (!x->is_nil()) {
+      size_type left = x->leftChild->count;
+
+      if (k < left) {
+        x = x->leftChild;
+      } else if (k == left) {
+        break;
+      } else {
+        k -= left + 1;
+        x = x->rightChild;
+      }
+    }
+    return (x);
+  }
+
+  // k보다 작은 노드의 수. lower_bound와 같은 경로로 내려가며 왼쪽에 남겨둔
+  // sub-tree의 크기를 더한다. (Ranked인 경우만)
+  template < typename K >
+  size_type rank(const K& k) const {
+    node_type* x = this->_root;
+    size_type r = 0;
+
+    if (is_empty_tree()) {
+      return (0);
+    }
+    while (!x->is_nil()) {
+      if (_comp(x->value, k)) {
+        r += x->leftChild->count + 1;
+        x = x->rightChild;
+      } else {
+        x = x->leftChild;
+      }
+    }
+    return (r);
+  }
+
+  /**
+   * 같은 값이 이미 있으면 (그 노드, false)를 리턴한다. 이때는 노드를 만들지
+   * 않는다. 없으면 자리를 찾은 뒤에 노드를 만들어 단다.
+   */
   ft::pair< node_type*, bool > insert(const value_type& val,
                                       node_type* hint = NULL) {
-    node_type* position = this->_root;
-    node_type* inserted = make_val_node(val);
+    bool left;
+    ft::pair< node_type*, bool > position =
+        find_insert_position(val, hint, left);
 
-    // 비어있는 tree인 경우를 먼저 처리하고 리턴 시켜버림.
-    if (is_empty_tree()) {
-      return (insert_root(inserted));
+    if (!position.second) {
+      return (position);
+    }
+    return (ft::make_pair(insert_at(position.first, left, val), true));
+  }
+
+#if __cplusplus >= 201103L
+  ft::pair< node_type*, bool > insert(value_type&& val,
+                                      node_type* hint = NULL) {
+    bool left;
+    ft::pair< node_type*, bool > position =
+        find_insert_position(val, hint, left);
+
+    if (!position.second) {
+      return (position);
+    }
+    return (ft::make_pair(emplace_at(position.first, left, std::move(val)),
+                          true));
+  }
+
+  /**
+   * args로 value를 만들어야 비교할 수 있으므로 노드를 먼저 만든다.
+   * 같은 값이 이미 있으면 만든 노드를 반환하고 (그 노드, false)를 리턴.
+   */
+  template < typename... Args >
+  ft::pair< node_type*, bool > emplace(node_type* hint, Args&&... args) {
+    node_type* node = make_val_node(std::forward< Args >(args)...);
+    ft::pair< node_type*, bool > position;
+    bool left;
+
+    try {
+      position = find_insert_position(node->value, hint, left);
+    } catch (...) {
+      destroy_subtree(node);
+      throw;
+    }
+    if (!position.second) {
+      destroy_subtree(node);
+      return (position);
     }
+    return (ft::make_pair(link_node(position.first, left, node), true));
+  }
+#endif
 
-    // hint위치가 올바르지 않으면 root-node부터 탐색한다.
-    if (hint != NULL && !hint->is_nil()) {
-      position = check_hint(val, hint);
+  /**
+   * k가 들어갈 자리를 찾는다.
+   * k와 같은 노드가 있으면 (그 노드, false),
+   * 없으면 (parent가 될 노드, true)를 리턴하고, left에 parent의 왼쪽 자리인지
+   * 담는다. (빈 tree면 parent는 nil)
+   * hint 위치가 올바르지 않으면 root-node부터 탐색한다.
+   */
+  template < typename K >
+  ft::pair< node_type*, bool > find_insert_position(const K& k,
+                                                    node_type* hint,
+                                                    bool& left) {
+    ensure_nil();
+
+    node_type* position = this->_root;
+    node_type* parent = this->_nil;
+
+    left = false;
+    if (hint != NULL && !hint->is_nil() && !is_empty_tree()) {
+      position = check_hint(k, hint);
     }
+    while (!position->is_nil()) {
+      parent = position;
+      if (_comp(k, position->value)) {  // position 기준 왼쪽으로
+        left = true;
+        position = position->leftChild;
+      } else if (_comp(position->value, k)) {  // position 기준 오른쪽으로
+        left = false;
+        position = position->rightChild;
+      } else {
+        return (ft::make_pair(position, false));
+      }
+    }
+    return (ft::make_pair(parent, true));
+  }
+
+  /**
+   * find_insert_position으로 찾은 자리(parent의 left 또는 right)에 val을
+   * 담은 노드를 만들어 달고 균형을 맞춘다. 새 노드를 리턴.
+   */
+  node_type* insert_at(node_type* parent, bool left, const value_type& val) {
+    return (link_node(parent, left, make_val_node(val)));
+  }
+
+  // insert_at과 같은데 value를 args로 노드 안에 바로 construct 한다.
+#if __cplusplus >= 201103L
+  template < typename... Args >
+  node_type* emplace_at(node_type* parent, bool left, Args&&... args) {
+    return (link_node(parent, left,
+                      make_val_node(std::forward< Args >(args)...)));
+  }
+#else
+  template < typename A, typename B >
+  node_type* emplace_at(node_type* parent, bool left, const A& a,
+                        const B& b) {
+    return (link_node(parent, left, make_val_node(a, b)));
+  }
 
-    // 들어갈 자리 찾기.
-    ft::pair< node_type*, bool > tmp = find_insert_position(position, inserted);
-    if (!tmp.second) {
-      _node_alloc.destroy(inserted);
-      _node_alloc.deallocate(inserted, 1);
-      return (tmp);
+  // value_type(key, 기본값)을 노드 안에 만들어 단다. (map의 try_emplace(k))
+  template < typename K >
+  node_type* emplace_key_at(node_type* parent, bool left, const K& k) {
+    return (link_node(parent, left, make_key_node(k)));
+  }
+#endif
+
+  // 만들어진 노드를 parent의 left 또는 right에 달고 균형을 맞춘다.
+  node_type* link_node(node_type* parent, bool left, node_type* inserted) {
+    // 비어있는 tree인 경우를 먼저 처리하고 리턴 시켜버림.
+    if (parent->is_nil()) {
+      return (insert_root(inserted).first);
     }
-    position = tmp.first;
+    inserted->parent = parent;
+    if (left) {
+      parent->leftChild = inserted;
+    } else {
+      parent->rightChild = inserted;
+    }
+    counter::add_to_path(parent, 1);
 
-    // 여기로 넘어오면 일단 insert 됨.
+    // 양 끝 노드의 child로 붙은 경우 새로운 양 끝 노드가 된다.
+    if (parent == this->_leftmost && left) {
+      this->_leftmost = inserted;
+    } else if (parent == this->_rightmost && !left) {
+      this->_rightmost = inserted;
+    }
     ++this->_size;
     if (inserted->color == RED && inserted->parent->color == RED) {
       if (inserted->get_uncle_color() == BLACK) {
@@ -157,14 +435,35 @@ class RB_Tree {
         Recoloring(inserted);
       }
     }
-    this->_nil->parent = get_back_node();
-    return (ft::make_pair(inserted, true));
+    // 회전 중에 nil->parent가 바뀌었을 수 있다.
+    this->_nil->parent = this->_rightmost;
+    return (inserted);
+  }
+
+  /**
+   * [first, last)를 넣는다.
+   * 빈 tree에 forward iterator 이상으로 들어오면 노드를 먼저 다 만든 뒤
+   * 정렬(이미 정렬되어 있으면 생략), 중복 제거 후 한 번에 tree를 만든다.
+   * 그 외에는 하나씩 insert 한다.
+   */
+  template < typename InputIterator >
+  void insert_range(InputIterator first, InputIterator last) {
+    ensure_nil();
+    insert_range(first, last, ft::iterator_category(first));
   }
 
   size_type erase(node_type* target) {
     if (this->_nil == target) {
       return 0;
     }
+    // 노드를 옮기기 전에 양 끝 노드를 갱신해둔다.
+    // (양 끝 노드의 다음 / 이전 노드는 바로 옆이라 O(1)에 가깝다)
+    if (target == this->_leftmost) {
+      this->_leftmost = (++iterator(target)).base();
+    }
+    if (target == this->_rightmost) {
+      this->_rightmost = (--iterator(target)).base();
+    }
     // target-node를 왼쪽의 최대 또는 오른쪽의 최소 node와 위치 변경.
     // 원래 target-node 위치에는 대체할 node가 들어가있다.
     // 이후 target-node는 노드 자체를 삭제해야 함.
@@ -180,6 +479,8 @@ class RB_Tree {
     }
     // target-node가 RED인 경우, replace에서 정리 끝남.
     replace_node(target, child);
+    // 아래의 회전보다 먼저 target이 빠진 경로의 count를 줄여둔다.
+    counter::add_to_path(child->parent, -1);
     if (target->color == BLACK) {
       if (child->color == RED) {
         // target-node가 BLACK인데 Child-node가 RED인 경우,
@@ -195,128 +496,559 @@ class RB_Tree {
     }
     delete_node(target);
     // nil->parent 다시 세팅.
-    this->_nil->parent = get_back_node();
+    this->_nil->parent = this->_rightmost;
     return 1;
   }
 
-  void clear(node_type* p = NULL) {
-    if (p == NULL) {
-      p = this->_root;
-    }
-    if (p->is_nil()) {
+  /**
+   * pool_allocator를 쓰는 경우 노드를 하나씩 반환하지 않고
+   * chunk 단위로 한 번에 반환한다. nil은 pool 밖에 있으므로 그대로다.
+   * (clear 이전의 end() iterator도 계속 쓸 수 있다)
+   */
+  void clear() {
+    if (is_empty_tree()) {
       return;
     }
-    if (!p->leftChild->is_nil()) {
-      clear(p->leftChild);
-    }
-    if (!p->rightChild->is_nil()) {
-      clear(p->rightChild);
+    if (release_nodes()) {
+      this->_root = this->_nil;
+      this->_size = 0;
+    } else {
+      clear(this->_root);
     }
-    delete_node(p);
+    this->_nil->parent = this->_nil;
+    this->_leftmost = this->_nil;
+    this->_rightmost = this->_nil;
   }
 
   // k보다 크거나 같은 범위를 구하기 위함.
-  node_type* lower_bound(const value_type& k) const {
-    iterator itlow(get_front_node());
-
-    while (!itlow.base()->is_nil() && _comp(*itlow, k)) {
-      itlow++;
+  // root부터 한 번만 내려가며 k 이상인 노드 중 가장 작은 노드를 찾는다.
+  template < typename K >
+  node_type* lower_bound(const K& k) const {
+    if (is_empty_tree()) {
+      return (this->_nil);
     }
-    return (itlow.base());
+    return (lower_bound(this->_root, this->_nil, k));
   }
 
   // k보다 큰 범위를 구하기 위함.
-  node_type* upper_bound(const value_type& k) const {
-    iterator itup(lower_bound(k));
-
-    if (!itup.base()->is_nil() && !_comp(*itup, k) && !_comp(k, *itup)) {
-      itup++;
+  template < typename K >
+  node_type* upper_bound(const K& k) const {
+    if (is_empty_tree()) {
+      return (this->_nil);
     }
-    return (itup.base());
+    return (upper_bound(this->_root, this->_nil, k));
   }
 
-  void copy(const RB_Tree& x) {
-    clear();
-    copy(x._root);
+  /**
+   * k와 같은 범위 [lower, upper)를 한 번의 탐색으로 구한다.
+   * k와 같은 노드를 만나기 전까지는 lower, upper의 경로가 같으므로 같이
+   * 내려가고, 만난 뒤에는 그 노드의 left-sub-tree에서 lower를,
+   * right-sub-tree에서 upper를 마저 찾는다.
+   */
+  template < typename K >
+  ft::pair< node_type*, node_type* > equal_range(const K& k) const {
+    node_type* x = this->_root;
+    node_type* y = this->_nil;
+
+    if (is_empty_tree()) {
+      return (ft::make_pair(y, y));
+    }
+    while (!x->is_nil()) {
+      if (_comp(x->value, k)) {
+        x = x->rightChild;
+      } else if (_comp(k, x->value)) {
+        y = x;
+        x = x->leftChild;
+      } else {
+        return (ft::make_pair(lower_bound(x->leftChild, x, k),
+                              upper_bound(x->rightChild, y, k)));
+      }
+    }
+    return (ft::make_pair(y, y));
   }
 
-  void copy(node_type* node) {
-    if (node->is_nil()) {
-      return;
+  template < typename K >
+  size_type count(const K& k) const {
+    ft::pair< node_type*, node_type* > range = equal_range(k);
+    iterator it(range.first);
+    size_type n = 0;
+
+    for (; it.base() != range.second; ++it) {
+      ++n;
     }
-    insert(*node->value);
-    if (!node->leftChild->is_nil()) {
-      copy(node->leftChild);
+    return (n);
+  }
+
+  /**
+   * x와 같은 모양, 같은 색의 트리를 그대로 복제한다. (비교, 회전 없이 O(n))
+   * 기존 노드는 버리지 않고 reuse 리스트로 떼어 낸 뒤 복제할 때 다시 쓴다.
+   * 복제 중 예외가 나면 만들던 노드와 남은 노드를 모두 반환하고 빈 트리가
+   * 된다.
+   */
+  void copy(const RB_Tree& x) {
+    node_type* reuse = detach_nodes();
+
+    try {
+      if (!x.is_empty_tree()) {
+        this->_root = clone(x._root, this->_nil, reuse);
+      }
+    } catch (...) {
+      free_nodes(reuse);
+      throw;
     }
-    if (!node->rightChild->is_nil()) {
-      copy(node->rightChild);
+    free_nodes(reuse);
+    this->_size = x._size;
+    if (!this->_root->is_nil()) {
+      this->_leftmost = this->_root;
+      while (!this->_leftmost->leftChild->is_nil()) {
+        this->_leftmost = this->_leftmost->leftChild;
+      }
+      this->_rightmost = this->_root;
+      while (!this->_rightmost->rightChild->is_nil()) {
+        this->_rightmost = this->_rightmost->rightChild;
+      }
     }
+    this->_nil->parent = this->_rightmost;
   }
 
   void showMap() { ft::printMap(_root, 0); }
 
  private:
+  // 노드 메모리를 한 번에 받고, value는 그 안에 바로 construct 한다.
+#if __cplusplus >= 201103L
+  template < typename... Args >
+  node_type* make_val_node(Args&&... args) {
+    node_type* node = _node_alloc.allocate(1);
+
+    try {
+      // 인자 여러 개짜리 construct가 없는 allocator도 받기 위해 traits로.
+      std::allocator_traits< alloc_type >::construct(
+          _alloc, &node->value, std::forward< Args >(args)...);
+    } catch (...) {
+      _node_alloc.deallocate(node, 1);
+      throw;
+    }
+    return (init_val_node(node));
+  }
+#else
   node_type* make_val_node(const value_type& val) {
-    node_type* node;
+    node_type* node = _node_alloc.allocate(1);
+
+    try {
+      _alloc.construct(&node->value, val);
+    } catch (...) {
+      _node_alloc.deallocate(node, 1);
+      throw;
+    }
+    return (init_val_node(node));
+  }
 
-    node = _node_alloc.allocate(1);
-    _node_alloc.construct(node, node_type(val));
+  /**
+   * C++98 allocator의 construct는 value_type 하나만 받으므로,
+   * value_type(a, b)를 노드 안에 직접 만든다.
+   * (map의 try_emplace가 value_type 임시 객체를 한 번 더 복사하지 않도록)
+   */
+  template < typename A, typename B >
+  node_type* make_val_node(const A& a, const B& b) {
+    node_type* node = _node_alloc.allocate(1);
+
+    try {
+      ::new (static_cast< void* >(&node->value)) value_type(a, b);
+    } catch (...) {
+      _node_alloc.deallocate(node, 1);
+      throw;
+    }
+    return (init_val_node(node));
+  }
+
+  // make_val_node(a, b)와 같은데 second는 노드를 만들 때 기본값으로 만든다.
+  template < typename K >
+  node_type* make_key_node(const K& k) {
+    typedef typename value_type::second_type second_type;
+    node_type* node = _node_alloc.allocate(1);
+
+    try {
+      ::new (static_cast< void* >(&node->value)) value_type(k, second_type());
+    } catch (...) {
+      _node_alloc.deallocate(node, 1);
+      throw;
+    }
+    return (init_val_node(node));
+  }
+#endif
+
+  // value가 construct 된 노드의 나머지 필드를 채운다.
+  node_type* init_val_node(node_type* node) {
+    node->leftChild = this->_nil;
+    node->rightChild = this->_nil;
+    node->parent = this->_nil;
+    node->color = RED;
+    node->nil = false;
+    counter::init(node, 1);
     return (node);
   }
 
+  /**
+   * move로 nil까지 넘겨준 tree에 nil을 다시 만든다.
+   * node allocator도 value allocator에서 새로 만든다. (pool_allocator인
+   * 경우 노드를 가져간 tree와 pool을 공유하지 않기 위함)
+   */
+  void ensure_nil() {
+    if (this->_nil != NULL) {
+      return;
+    }
+    this->_node_alloc = node_alloc_type(this->_alloc);
+    this->_nil = make_nil_node();
+    this->_root = this->_nil;
+    this->_leftmost = this->_nil;
+    this->_rightmost = this->_nil;
+  }
+
+  // nil 노드는 value를 construct 하지 않는다.
+  // pool_allocator인 경우 release_nodes()로 반환되지 않도록 pool 밖에 둔다.
   node_type* make_nil_node() {
-    node_type* node;
+    node_type* node = ft::allocate_outside_pool(_node_alloc);
+
+    node->leftChild = node;
+    node->rightChild = node;
+    node->parent = node;
+    node->color = BLACK;
+    node->nil = true;
+    counter::init(node, 0);
+    return (node);
+  }
 
-    node = _node_alloc.allocate(1);
-    _node_alloc.construct(node, node_type());
+  // x를 root로 하는 sub-tree에서 k 이상인 가장 작은 노드.
+  // 그런 노드가 없으면 bound를 리턴한다.
+  template < typename K >
+  node_type* lower_bound(node_type* x, node_type* bound, const K& k) const {
+    while (!x->is_nil()) {
+      if (!_comp(x->value, k)) {
+        bound = x;
+        x = x->leftChild;
+      } else {
+        x = x->rightChild;
+      }
+    }
+    return (bound);
+  }
+
+  // x를 root로 하는 sub-tree에서 k보다 큰 가장 작은 노드.
+  // 그런 노드가 없으면 bound를 리턴한다.
+  template < typename K >
+  node_type* upper_bound(node_type* x, node_type* bound, const K& k) const {
+    while (!x->is_nil()) {
+      if (_comp(k, x->value)) {
+        bound = x;
+        x = x->leftChild;
+      } else {
+        x = x->rightChild;
+      }
+    }
+    return (bound);
+  }
+
+  template < typename InputIterator >
+  void insert_range(InputIterator first, InputIterator last,
+                    ft::input_iterator_tag) {
+    for (; first != last; ++first) {
+      insert(*first);
+    }
+  }
+
+  template < typename ForwardIterator >
+  void insert_range(ForwardIterator first, ForwardIterator last,
+                    ft::forward_iterator_tag) {
+    if (!is_empty_tree()) {
+      insert_range(first, last, ft::input_iterator_tag());
+      return;
+    }
+    const size_type n = ft::distance(first, last);
+    if (n == 0) {
+      return;
+    }
+    node_ptr_alloc_type ptr_alloc(_alloc);
+    node_type** nodes = ptr_alloc.allocate(n);
+    size_type made = 0;
+    size_type unique;
+
+    try {
+      for (; made < n; ++made, ++first) {
+        nodes[made] = make_val_node(*first);
+      }
+      unique = sort_unique(nodes, n, ptr_alloc);
+    } catch (...) {
+      for (size_type i = 0; i < made; ++i) {
+        _alloc.destroy(&nodes[i]->value);
+        _node_alloc.deallocate(nodes[i], 1);
+      }
+      ptr_alloc.deallocate(nodes, n);
+      throw;
+    }
+    // 중복으로 뒤에 밀려난 노드들.
+    for (size_type i = unique; i < n; ++i) {
+      _alloc.destroy(&nodes[i]->value);
+      _node_alloc.deallocate(nodes[i], 1);
+    }
+    build_sorted(nodes, unique);
+    ptr_alloc.deallocate(nodes, n);
+  }
+
+  /**
+   * nodes를 정렬하고 같은 값 중 앞의 것만 남긴다. 남은 개수를 리턴.
+   * 중복 노드는 [리턴값, n)으로 밀려난다.
+   * 예외가 나도 nodes에는 n개의 노드가 모두 남아 있다.
+   */
+  size_type sort_unique(node_type** nodes, size_type n,
+                        node_ptr_alloc_type& ptr_alloc) {
+    bool sorted = true;
+    bool unique = true;
+
+    for (size_type i = 1; i < n && sorted; ++i) {
+      if (_comp(nodes[i]->value, nodes[i - 1]->value)) {
+        sorted = false;
+      } else if (!_comp(nodes[i - 1]->value, nodes[i]->value)) {
+        unique = false;
+      }
+    }
+    if (sorted && unique) {
+      return (n);
+    }
+    if (!sorted) {
+      merge_sort(nodes, n, ptr_alloc);
+    }
+    // 자리를 바꾸는 식으로 앞으로 모은다. (중간에 예외가 나도 노드를
+    // 잃어버리지 않게)
+    size_type k = 1;
+    for (size_type i = 1; i < n; ++i) {
+      if (_comp(nodes[k - 1]->value, nodes[i]->value)) {
+        node_type* tmp = nodes[k];
+
+        nodes[k++] = nodes[i];
+        nodes[i] = tmp;
+      }
+    }
+    return (k);
+  }
+
+  /**
+   * bottom-up merge sort. 같은 값은 원래 순서를 유지한다.
+   * (map, set의 range insert는 같은 key 중 먼저 나온 것이 들어가야 함)
+   * 두 버퍼를 번갈아 쓰므로 예외가 나면 마지막으로 완성된 버퍼를 nodes로
+   * 돌려놓는다.
+   */
+  void merge_sort(node_type** nodes, size_type n,
+                  node_ptr_alloc_type& ptr_alloc) {
+    node_type** buf = ptr_alloc.allocate(n);
+    node_type** src = nodes;
+    node_type** dst = buf;
+
+    try {
+      for (size_type width = 1; width < n; width *= 2) {
+        for (size_type lo = 0; lo < n; lo += width * 2) {
+          size_type mid = std::min(lo + width, n);
+          size_type hi = std::min(lo + width * 2, n);
+          size_type i = lo;
+          size_type j = mid;
+          size_type k = lo;
+
+          while (i < mid && j < hi) {
+            if (_comp(src[j]->value, src[i]->value)) {
+              dst[k++] = src[j++];
+            } else {
+              dst[k++] = src[i++];
+            }
+          }
+          while (i < mid) {
+            dst[k++] = src[i++];
+          }
+          while (j < hi) {
+            dst[k++] = src[j++];
+          }
+        }
+        std::swap(src, dst);
+      }
+    } catch (...) {
+      if (src != nodes) {
+        std::copy(src, src + n, nodes);
+      }
+      ptr_alloc.deallocate(buf, n);
+      throw;
+    }
+    if (src != nodes) {
+      std::copy(src, src + n, nodes);
+    }
+    ptr_alloc.deallocate(buf, n);
+  }
+
+  /**
+   * 정렬된 노드 n개로 균형 잡힌 tree를 만든다. O(n)
+   * 가운데 노드를 root로 나누어 가면 leaf 깊이의 차이가 최대 1이므로,
+   * 가장 깊은 층(floor(log2 n))만 RED로 칠하면 모든 경로의 BLACK 수가 같다.
+   */
+  void build_sorted(node_type** nodes, size_type n) {
+    size_type red_depth = 0;
+
+    for (size_type m = n; m > 1; m >>= 1) {
+      ++red_depth;
+    }
+    this->_root = build_sorted(nodes, 0, n, this->_nil, 0, red_depth);
+    this->_root->color = BLACK;
+    this->_leftmost = nodes[0];
+    this->_rightmost = nodes[n - 1];
+    this->_nil->parent = this->_rightmost;
+    this->_size = n;
+  }
+
+  node_type* build_sorted(node_type** nodes, size_type lo, size_type hi,
+                          node_type* parent, size_type depth,
+                          size_type red_depth) {
+    if (lo == hi) {
+      return (this->_nil);
+    }
+    size_type mid = lo + (hi - lo) / 2;
+    node_type* node = nodes[mid];
+
+    node->parent = parent;
+    node->color = (depth == red_depth) ? RED : BLACK;
+    node->leftChild =
+        build_sorted(nodes, lo, mid, node, depth + 1, red_depth);
+    node->rightChild =
+        build_sorted(nodes, mid + 1, hi, node, depth + 1, red_depth);
+    counter::update(node);
     return (node);
   }
 
+  // 모든 노드를 트리에서 떼어 parent로 이은 리스트로 만들고 빈 트리가 된다.
+  // value는 아직 destroy 하지 않는다.
+  node_type* detach_nodes() {
+    node_type* list = detach_nodes(this->_root, NULL);
+
+    this->_root = this->_nil;
+    this->_leftmost = this->_nil;
+    this->_rightmost = this->_nil;
+    this->_nil->parent = this->_nil;
+    this->_size = 0;
+    return (list);
+  }
+
+  node_type* detach_nodes(node_type* p, node_type* list) {
+    if (p->is_nil()) {
+      return (list);
+    }
+    list = detach_nodes(p->leftChild, list);
+    list = detach_nodes(p->rightChild, list);
+    p->parent = list;
+    return (p);
+  }
+
+  // reuse 리스트에 노드가 남아 있으면 그 노드에 val을 다시 construct 한다.
+  node_type* reuse_or_make_node(const value_type& val, node_type*& reuse) {
+    if (reuse == NULL) {
+      return (make_val_node(val));
+    }
+    node_type* node = reuse;
+
+    reuse = reuse->parent;
+    _alloc.destroy(&node->value);
+    try {
+      _alloc.construct(&node->value, val);
+    } catch (...) {
+      _node_alloc.deallocate(node, 1);
+      throw;
+    }
+    node->leftChild = this->_nil;
+    node->rightChild = this->_nil;
+    node->parent = this->_nil;
+    return (node);
+  }
+
+  // src sub-tree를 복제해 parent 아래에 단다. 복제된 sub-tree의 root를 리턴.
+  node_type* clone(node_type* src, node_type* parent, node_type*& reuse) {
+    node_type* node = reuse_or_make_node(src->value, reuse);
+
+    node->color = src->color;
+    node->parent = parent;
+    counter::copy(node, src);
+    try {
+      if (!src->leftChild->is_nil()) {
+        node->leftChild = clone(src->leftChild, node, reuse);
+      }
+      if (!src->rightChild->is_nil()) {
+        node->rightChild = clone(src->rightChild, node, reuse);
+      }
+    } catch (...) {
+      destroy_subtree(node);
+      throw;
+    }
+    return (node);
+  }
+
+  // _size, _root와 상관없이 sub-tree의 노드를 반환한다.
+  void destroy_subtree(node_type* p) {
+    if (p->is_nil()) {
+      return;
+    }
+    destroy_subtree(p->leftChild);
+    destroy_subtree(p->rightChild);
+    _alloc.destroy(&p->value);
+    _node_alloc.deallocate(p, 1);
+  }
+
+  // detach_nodes로 떼어 낸 뒤 쓰이지 않고 남은 노드를 반환한다.
+  void free_nodes(node_type* list) {
+    while (list != NULL) {
+      node_type* next = list->parent;
+
+      _alloc.destroy(&list->value);
+      _node_alloc.deallocate(list, 1);
+      list = next;
+    }
+  }
+
+  void clear(node_type* p) {
+    if (!p->leftChild->is_nil()) {
+      clear(p->leftChild);
+    }
+    if (!p->rightChild->is_nil()) {
+      clear(p->rightChild);
+    }
+    delete_node(p);
+  }
+
+  void destroy_values(node_type* p) {
+    if (p->is_nil()) {
+      return;
+    }
+    destroy_values(p->leftChild);
+    destroy_values(p->rightChild);
+    _alloc.destroy(&p->value);
+  }
+
+  // pool_allocator인 경우에만 value를 destroy 하고 노드 메모리를 한 번에
+  // 반환한 뒤 true를 리턴한다. (nil은 pool 밖에 있으므로 남는다)
+  bool release_nodes() {
+    if (!ft::is_pool_allocator< node_alloc_type >::value) {
+      return (false);
+    }
+    destroy_values(this->_root);
+    ft::release_pool(_node_alloc);
+    return (true);
+  }
+
   ft::pair< node_type*, bool > insert_root(node_type* inserted) {
     this->_root = inserted;
     this->_root->leftChild = this->_nil;
     this->_root->rightChild = this->_nil;
     this->_root->parent = this->_nil;
     this->_nil->parent = this->_root;
+    this->_leftmost = this->_root;
+    this->_rightmost = this->_root;
     this->_root->color = BLACK;
     ++this->_size;
     return (ft::make_pair(this->_root, true));
   }
 
-  ft::pair< node_type*, bool > find_insert_position(node_type* position,
-                                                    node_type* inserted) {
-    while (!position->is_nil()) {
-      if (_comp(*(inserted->value),
-                *(position->value))) {  // position 기준 왼쪽으로
-        if (position->leftChild->is_nil()) {
-          // position의 leftChild 자리로 들어감.
-          position->leftChild = inserted;
-          inserted->parent = position;
-          inserted->leftChild = this->_nil;
-          inserted->rightChild = this->_nil;
-          break;
-        } else {
-          position = position->leftChild;
-        }
-      } else if (_comp(*(position->value),
-                       *(inserted->value))) {  // position 기준 오른쪽으로
-        if (position->rightChild->is_nil()) {
-          // position의 rightChild 자리로 들어감.
-          position->rightChild = inserted;
-          inserted->parent = position;
-          inserted->leftChild = this->_nil;
-          inserted->rightChild = this->_nil;
-          break;
-        } else {
-          position = position->rightChild;
-        }
-      } else {
-        return (ft::make_pair(position, false));
-      }
-    }
-    return (ft::make_pair(position, true));
-  }
-
   bool is_double_RED(node_type* child, node_type* parent) {
     return (child->color == RED && parent->color == RED);
   }
@@ -381,8 +1113,8 @@ class RB_Tree {
     node_type *prevChild_A, *prevChild_B, *prevChild_C, *prevChild_D;
     node_type* order[3];
 
-    if (_comp(*node->value, *node->parent->value) &&
-        _comp(*node->parent->value, *node->parent->parent->value)) {
+    if (_comp(node->value, node->parent->value) &&
+        _comp(node->parent->value, node->parent->parent->value)) {
       order[0] = node;
       order[1] = node->parent;
       order[2] = node->parent->parent;
@@ -390,8 +1122,8 @@ class RB_Tree {
       prevChild_B = node->rightChild;
       prevChild_C = node->parent->rightChild;
       prevChild_D = node->parent->parent->rightChild;
-    } else if (_comp(*node->parent->value, *node->value) &&
-               _comp(*node->value, *node->parent->parent->value)) {
+    } else if (_comp(node->parent->value, node->value) &&
+               _comp(node->value, node->parent->parent->value)) {
       order[0] = node->parent;
       order[1] = node;
       order[2] = node->parent->parent;
@@ -399,8 +1131,8 @@ class RB_Tree {
       prevChild_B = node->leftChild;
       prevChild_C = node->rightChild;
       prevChild_D = node->parent->parent->rightChild;
-    } else if (_comp(*node->parent->parent->value, *node->parent->value) &&
-               _comp(*node->parent->value, *node->value)) {
+    } else if (_comp(node->parent->parent->value, node->parent->value) &&
+               _comp(node->parent->value, node->value)) {
       order[0] = node->parent->parent;
       order[1] = node->parent;
       order[2] = node;
@@ -408,8 +1140,8 @@ class RB_Tree {
       prevChild_B = node->parent->leftChild;
       prevChild_C = node->leftChild;
       prevChild_D = node->rightChild;
-    } else {  // _comp(*node->parent->parent->value, *node->value) &&
-      //            _comp(*node->value, *node->parent->value)
+    } else {  // _comp(node->parent->parent->value, node->value) &&
+      //            _comp(node->value, node->parent->value)
       order[0] = node->parent->parent;
       order[1] = node;
       order[2] = node->parent;
@@ -438,6 +1170,9 @@ class RB_Tree {
     order[0]->color = RED;
     order[1]->color = BLACK;
     order[2]->color = RED;
+    counter::update(order[0]);
+    counter::update(order[2]);
+    counter::update(order[1]);
   }
 
   void connect_left(node_type* parent, node_type* child) {
@@ -467,6 +1202,8 @@ class RB_Tree {
     p->rightChild = new_p->leftChild;
     p->rightChild->parent = p;
     new_p->leftChild = p;
+    counter::update(p);
+    counter::update(new_p);
     set_root(p);
   }
 
@@ -478,6 +1215,8 @@ class RB_Tree {
     p->leftChild = new_p->rightChild;
     p->leftChild->parent = p;
     new_p->rightChild = p;
+    counter::update(p);
+    counter::update(new_p);
     set_root(p);
   }
 
@@ -490,9 +1229,10 @@ class RB_Tree {
    * 2) hint가 rightChild인 경우, parent를 따라가다가 처음으로 leftChild인
    * 노드의 parent보다 작으면 hint부터 탐색.
    */
-  node_type* check_hint(value_type val, node_type* hint) {
-    if (_comp(*(hint->value), val)) {
-      if (hint->is_leftchild() && _comp(val, *(hint->parent->value))) {
+  template < typename K >
+  node_type* check_hint(const K& val, node_type* hint) const {
+    if (_comp(hint->value, val)) {
+      if (hint->is_leftchild() && _comp(val, hint->parent->value)) {
         return hint;
       } else if (hint->is_rightchild()) {
         node_type* tmp = hint->parent;
@@ -500,7 +1240,7 @@ class RB_Tree {
         while (tmp->is_rightchild()) {
           tmp = tmp->parent;
         }
-        if (tmp->is_leftchild() && !_comp(val, *(tmp->parent->value))) {
+        if (tmp->is_leftchild() && !_comp(val, tmp->parent->value)) {
           return (this->_root);
         }
         return hint;
@@ -515,7 +1255,6 @@ class RB_Tree {
   node_type* switch_to_erase(node_type* target) {
     iterator tmp(target);
     node_type* n;
-    alloc_type _alloc;
 
     // target노드가 tree 가지 끝의 노드인 경우.
     if (target->leftChild->is_nil() && target->rightChild->is_nil()) {
@@ -574,6 +1313,7 @@ class RB_Tree {
       this->_root = n;
     }
     n->color = tmp_c;
+    counter::swap(target, n);
 
     return target;
   }
@@ -709,7 +1449,7 @@ class RB_Tree {
       this->_root = this->_nil;
     }
 
-    _node_alloc.destroy(node);
+    _alloc.destroy(&node->value);
     _node_alloc.deallocate(node, 1);
     --this->_size;
   }
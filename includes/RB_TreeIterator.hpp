@@ -18,7 +18,12 @@
 #include "utils.hpp"
 
 namespace ft {
-template < typename T, typename Pointer = T *, typename Reference = T & >
+/**
+ * Ranked는 노드가 sub-tree 크기를 갖는지. (RB_TreeNode 참고)
+ * Ranked인 iterator 사이의 ft::distance는 O(log n)이다.
+ */
+template < typename T, typename Pointer = T *, typename Reference = T &,
+           bool Ranked = false >
 class RB_TreeIterator
     : public ft::iterator< ft::bidirectional_iterator_tag, T > {
  public:
@@ -29,7 +34,7 @@ class RB_TreeIterator
                                  T >::difference_type difference_type;
   typedef typename ft::iterator< ft::bidirectional_iterator_tag,
                                  T >::iterator_category iterator_category;
-  typedef ft::RB_TreeNode< T > node_type;
+  typedef ft::RB_TreeNode< T, Ranked > node_type;
 
  private:
   node_type *np;
@@ -81,14 +86,18 @@ class RB_TreeIterator
   }
 
  public:
+  // 복사 생성자, 대입 연산자, 소멸자는 컴파일러가 만든 것을 쓴다.
+  // (node pointer 하나짜리 trivially copyable type)
   RB_TreeIterator(node_type *ptr = u_nullptr) : np(ptr) {}
-  RB_TreeIterator(const RB_TreeIterator< T > &other) : np(other.base()) {}
-  virtual ~RB_TreeIterator(){};
 
-  RB_TreeIterator &operator=(const RB_TreeIterator< T > &other) {
-    if (this != &other) this->np = other.base();
-    return (*this);
-  }
+  // iterator -> const_iterator 변환. template이라 복사 생성자는 아니고,
+  // const_iterator -> iterator 방향은 막는다.
+  template < typename P, typename R >
+  RB_TreeIterator(
+      const RB_TreeIterator< T, P, R, Ranked > &other,
+      typename ft::enable_if< ft::is_same< P, T * >::value >::type * =
+          u_nullptr)
+      : np(other.base()) {}
 
   operator RB_TreeIterator< const T >() const {
     return (RB_TreeIterator< const T >(this->np));
@@ -96,9 +105,9 @@ class RB_TreeIterator
 
   node_type *const &base() const { return (this->np); }
 
-  reference operator*() const { return (*(this->np->value)); }
+  reference operator*() const { return (this->np->value); }
 
-  pointer operator->() const { return (this->np->value); }
+  pointer operator->() const { return (&this->np->value); }
 
   RB_TreeIterator &operator++() {
     this->np = get_next();
@@ -122,17 +131,26 @@ class RB_TreeIterator
     return (tmp);
   }
 
-  template < class P, class Q, class R >
-  bool operator==(const ft::RB_TreeIterator< P, Q, R > &ot) {
+  template < class P, class Q, class R, bool B >
+  bool operator==(const ft::RB_TreeIterator< P, Q, R, B > &ot) {
     return (this->np == ot.base());
   }
 
-  template < class P, class Q, class R >
-  bool operator!=(const ft::RB_TreeIterator< P, Q, R > &ot) {
+  template < class P, class Q, class R, bool B >
+  bool operator!=(const ft::RB_TreeIterator< P, Q, R, B > &ot) {
     return (this->np != ot.base());
   }
 };
 
+// ft::distance가 ADL로 찾는다. (utils.hpp) 두 노드의 위치 차이.
+template < typename T, typename P, typename R >
+typename RB_TreeIterator< T, P, R, true >::difference_type distance_by_tag(
+    RB_TreeIterator< T, P, R, true > first,
+    RB_TreeIterator< T, P, R, true > last, ft::bidirectional_iterator_tag) {
+  return (static_cast< ptrdiff_t >(ft::node_index(last.base())) -
+          static_cast< ptrdiff_t >(ft::node_index(first.base())));
+}
+
 }  // namespace ft
 
 #endif  // RB_TREEITERATOR_HPP
@@ -13,65 +13,42 @@
 #if !defined(RB_TREENODE_HPP)
 #define RB_TREENODE_HPP
 
+#include <cstddef>
 #include <memory>
 
 namespace ft {
 
 enum Color { RED, BLACK };
 
-template < typename T, typename Alloc = std::allocator< T > >
-struct RB_TreeNode {
+/**
+ * Ranked인 노드는 자기를 root로 하는 sub-tree의 노드 수를 갖는다.
+ * (nil은 0) 아니면 빈 base라 노드 크기가 그대로다.
+ */
+template < bool Ranked >
+struct RB_TreeNodeCount {};
+
+template <>
+struct RB_TreeNodeCount< true > {
+  size_t count;
+};
+
+/**
+ * value를 노드 안에 같이 담는다. (element 하나당 할당 1번)
+ * 노드는 RB_Tree가 node allocator로 메모리만 받아 필드를 직접 세팅하고,
+ * value는 value allocator로 그 자리에 construct 한다.
+ * nil 노드는 value를 construct 하지 않으므로 nil 필드로 구분한다.
+ */
+template < typename T, bool Ranked = false >
+struct RB_TreeNode : public RB_TreeNodeCount< Ranked > {
  public:
   typedef T value_type;
 
-  T *value;
   RB_TreeNode *leftChild;
   RB_TreeNode *rightChild;
   RB_TreeNode *parent;
   Color color;
-  Alloc alloc;
-
-  RB_TreeNode()
-      : value(NULL),
-        leftChild(NULL),
-        rightChild(NULL),
-        parent(NULL),
-        color(BLACK),
-        alloc(Alloc()) {
-    // nil-node
-  }
-
-  RB_TreeNode(const T &val)
-      : value(NULL),
-        leftChild(NULL),
-        rightChild(NULL),
-        parent(NULL),
-        color(RED),
-        alloc(Alloc()) {
-    this->value = alloc.allocate(1);
-    alloc.construct(this->value, val);
-  }
-
-  RB_TreeNode(const RB_TreeNode &ot)
-      : value(NULL),
-        leftChild(NULL),
-        rightChild(NULL),
-        parent(NULL),
-        color(RED),
-        alloc(Alloc()) {
-    if (ot.value != NULL) {
-      this->value = alloc.allocate(1);
-      alloc.construct(this->value, *(ot.value));
-      this->color = ot.color;
-    }
-  }
-
-  ~RB_TreeNode() {
-    if (this->value != NULL) {
-      alloc.destroy(value);
-      alloc.deallocate(value, 1);
-    }
-  }
+  bool nil;
+  T value;
 
   bool is_root() const {
     if (this->parent->is_nil()) {
@@ -95,12 +72,7 @@ struct RB_TreeNode {
   }
 
   // nil 노드.
-  bool is_nil() const {
-    if (this->value == NULL) {
-      return true;
-    }
-    return false;
-  }
+  bool is_nil() const { return (this->nil); }
 
   Color get_uncle_color() const {
     if (this->parent->is_leftchild())
@@ -110,20 +82,42 @@ struct RB_TreeNode {
   }
 
   bool operator<(const RB_TreeNode &other) const {
-    return (*(this->value) < *(other->value));
+    return (this->value < other.value);
   }
 
   bool operator>(const RB_TreeNode &other) const { return (other < *this); }
 
   bool operator==(const RB_TreeNode &other) const {
-    return (*(this->value) == *(other->value));
+    return (this->value == other.value);
   }
 
   bool operator!=(const RB_TreeNode &other) const {
-    return (*(this->value) != *(other->value));
+    return (this->value != other.value);
   }
 };
 
+/**
+ * 노드의 in-order 위치. (앞에 있는 노드 수) O(log n)
+ * 왼쪽 sub-tree의 크기에서 시작해 root로 올라가며, 오른쪽 child로
+ * 올라온 경우 parent와 parent의 왼쪽 sub-tree를 더한다.
+ * nil(end)의 parent는 가장 큰 노드이므로 그 다음 위치, 빈 tree면 0.
+ */
+template < typename T >
+size_t node_index(const RB_TreeNode< T, true > *node) {
+  if (node->is_nil()) {
+    return (node->parent->is_nil() ? 0 : node_index(node->parent) + 1);
+  }
+  size_t index = node->leftChild->count;
+
+  while (!node->is_root()) {
+    if (node->is_rightchild()) {
+      index += node->parent->leftChild->count + 1;
+    }
+    node = node->parent;
+  }
+  return (index);
+}
+
 }  // namespace ft
 
 #endif  // RB_TREENODE_HPP
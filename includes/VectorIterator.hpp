@@ -33,19 +33,14 @@ class VectorIterator
   pointer _ptr;
 
  public:
+  // 복사 생성자, 대입 연산자, 소멸자는 컴파일러가 만든 것을 쓴다.
+  // (pointer 하나짜리 trivially copyable type으로 두어 register에 올라가게)
   VectorIterator(pointer ptr = u_nullptr) : _ptr(ptr) {}
-  VectorIterator(const VectorIterator< T > &other) : _ptr(other.base()) {}
-  virtual ~VectorIterator() {}
 
   operator VectorIterator< const T >() const {
     return (VectorIterator< const T >(this->_ptr));
   }
 
-  VectorIterator &operator=(const VectorIterator< T > &other) {
-    if (this != &other) this->_ptr = other.base();
-    return (*this);
-  }
-
   pointer const &base() const { return (this->_ptr); }
 
   reference operator*() const { return (*this->_ptr); }
@@ -33,20 +33,13 @@ class bidirectional_iterator
   pointer _ptr;
 
  public:
+  // 복사 생성자, 대입 연산자, 소멸자는 컴파일러가 만든 것을 쓴다.
   bidirectional_iterator(pointer ptr = u_nullptr) : _ptr(ptr) {}
-  bidirectional_iterator(const bidirectional_iterator< T > &other)
-      : _ptr(other.base()) {}
-  virtual ~bidirectional_iterator() {}
 
   operator bidirectional_iterator< const T >() const {
     return (bidirectional_iterator< const T >(this->_ptr));
   }
 
-  bidirectional_iterator &operator=(const bidirectional_iterator< T > &other) {
-    if (this != &other) this->_ptr = other.base();
-    return (*this);
-  }
-
   pointer const &base() const { return (this->_ptr); }
 
   reference operator*() const { return (*this->_ptr); }
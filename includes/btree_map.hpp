@@ -0,0 +1,436 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(BTREE_MAP_HPP)
+#define BTREE_MAP_HPP
+
+#include <algorithm>
+#include <memory>
+
+#include "BTree.hpp"
+#include "BTreeIterator.hpp"
+#include "utils.hpp"
+
+namespace ft {
+/**
+ * B+ tree(BTree)에 담는 map. 인터페이스는 ft::map과 같다.
+ * 노드 하나에 key 여러 개가 모여 있어서 map보다 할당과 포인터가 적고,
+ * 탐색이 노드마다 cache line 몇 개 안에서 끝난다.
+ * 노드 크기는 NodeBytes로 바꿀 수 있다. (기본 512 bytes = cache line 8개.
+ * int key면 leaf 하나에 59개. 64 bytes처럼 작으면 tree가 높아져서 오히려
+ * 느리다. bench/btree_map.cpp 참고)
+ *
+ * iterator는 flat_map과 같이 flat_map_reference를 리턴한다.
+ * insert / erase 후에는 모든 iterator가 무효가 된다. (map과 다름)
+ */
+template < class Key, class T, class Compare = ft::less< Key >,
+           class Alloc = std::allocator< ft::pair< const Key, T > >,
+           size_t NodeBytes = 512 >
+class btree_map {
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef ft::pair< const key_type, mapped_type > value_type;
+  typedef Compare key_compare;
+
+  class value_compare : ft::binary_function< value_type, value_type, bool > {
+    friend class btree_map;
+
+   protected:
+    Compare comp;
+    value_compare(Compare c) : comp(c) {}
+
+   public:
+    typedef bool result_type;
+    typedef value_type first_argument_type;
+    typedef value_type second_argument_type;
+    value_compare() : comp() {}
+    bool operator()(const value_type& x, const value_type& y) const {
+      return comp(x.first, y.first);
+    }
+  };
+
+ private:
+  typedef ft::BTree< key_type, mapped_type, key_compare, Alloc, NodeBytes >
+      tree_type;
+  typedef typename tree_type::leaf_type leaf_type;
+  typedef typename tree_type::position position;
+
+ public:
+  typedef Alloc allocator_type;
+  typedef ft::BTreeIterator< key_type, mapped_type, leaf_type > iterator;
+  typedef ft::BTreeIterator< key_type, const mapped_type, leaf_type >
+      const_iterator;
+  typedef typename iterator::reference reference;
+  typedef typename const_iterator::reference const_reference;
+  typedef typename iterator::pointer pointer;
+  typedef typename const_iterator::pointer const_pointer;
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  typedef typename iterator::difference_type difference_type;
+  typedef size_t size_type;
+
+ private:
+  tree_type _tree;
+  key_compare _comp;
+  allocator_type _alloc;
+
+  // transparent comparator인 경우에만 K로 탐색하는 함수를 허용한다.
+  template < typename K, typename R >
+  struct if_transparent
+      : ft::enable_if< ft::is_transparent< Compare, K >::value, R > {};
+
+ public:
+  explicit btree_map(const key_compare& comp = key_compare(),
+                     const allocator_type& alloc = allocator_type())
+      : _tree(comp, alloc), _comp(comp), _alloc(alloc) {}
+
+  template < class InputIterator >
+  btree_map(InputIterator first, InputIterator last,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type(),
+            typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                    InputIterator >::type* = u_nullptr)
+      : _tree(comp, alloc), _comp(comp), _alloc(alloc) {
+    insert(first, last);
+  }
+
+  btree_map(const btree_map& x)
+      : _tree(x._tree), _comp(x._comp), _alloc(x._alloc) {}
+
+  virtual ~btree_map() {}
+
+  // 복사본을 다 만든 뒤 바꾼다. (중간에 예외가 나도 *this는 그대로)
+  btree_map& operator=(const btree_map& x) {
+    if (this != &x) {
+      btree_map tmp(x);
+      this->swap(tmp);
+    }
+    return (*this);
+  }
+
+#if __cplusplus >= 201103L
+  // 빈 tree를 만든 뒤 x와 바꾼다. x는 빈 btree_map으로 남는다.
+  btree_map(btree_map&& x)
+      : _tree(x._comp, x._alloc), _comp(x._comp), _alloc(x._alloc) {
+    this->swap(x);
+  }
+
+  btree_map& operator=(btree_map&& x) {
+    if (this != &x) {
+      this->clear();
+      this->swap(x);
+    }
+    return (*this);
+  }
+#endif
+
+  iterator begin() { return (this->iterator_at(_tree.begin())); }
+  const_iterator begin() const { return (this->iterator_at(_tree.begin())); }
+  iterator end() { return (this->iterator_at(_tree.end())); }
+  const_iterator end() const { return (this->iterator_at(_tree.end())); }
+
+  reverse_iterator rbegin() { return (reverse_iterator(this->end())); }
+  const_reverse_iterator rbegin() const {
+    return (const_reverse_iterator(this->end()));
+  }
+  reverse_iterator rend() { return (reverse_iterator(this->begin())); }
+  const_reverse_iterator rend() const {
+    return (const_reverse_iterator(this->begin()));
+  }
+
+  bool empty() const { return (_tree.empty()); }
+  size_type size() const { return (_tree.size()); }
+  size_type max_size() const { return (_tree.max_size()); }
+
+  // k가 없을 때만 mapped_type()을 insert 한다.
+  mapped_type& operator[](const key_type& k) {
+    return (try_emplace(k).first->second);
+  }
+
+#if __cplusplus >= 201103L
+  /**
+   * k가 없으면 (k, mapped_type(args...))를 insert 한다.
+   * k가 이미 있으면 아무것도 만들지 않고 그 element를 리턴한다.
+   * 리턴값은 insert(val)과 같다.
+   */
+  template < class... Args >
+  pair< iterator, bool > try_emplace(const key_type& k, Args&&... args) {
+    position p = _tree.search(k);
+
+    if (_tree.is_key_at(p, k)) {
+      return (ft::make_pair(this->iterator_at(p), false));
+    }
+    p = _tree.insert_at(p, k, mapped_type(std::forward< Args >(args)...));
+    return (ft::make_pair(this->iterator_at(p), true));
+  }
+
+  // position은 hint, 강제 아님.
+  template < class... Args >
+  iterator try_emplace(iterator position, const key_type& k, Args&&... args) {
+    typename tree_type::position p =
+        _tree.hint_slot(this->position_of(position), k);
+
+    if (!_tree.is_key_at(p, k)) {
+      p = _tree.insert_at(p, k, mapped_type(std::forward< Args >(args)...));
+    }
+    return (this->iterator_at(p));
+  }
+
+  // args로 value_type을 먼저 만들어야 key를 알 수 있다.
+  template < class... Args >
+  pair< iterator, bool > emplace(Args&&... args) {
+    return (insert(value_type(std::forward< Args >(args)...)));
+  }
+
+  template < class... Args >
+  iterator emplace_hint(iterator position, Args&&... args) {
+    return (insert(position, value_type(std::forward< Args >(args)...)));
+  }
+#else
+  /**
+   * k가 없으면 (k, mapped_type(obj))를 insert 한다.
+   * k가 이미 있으면 아무것도 만들지 않고 그 element를 리턴한다.
+   * 리턴값은 insert(val)과 같다.
+   */
+  pair< iterator, bool > try_emplace(const key_type& k) {
+    return (insert_unique(k, mapped_type()));
+  }
+
+  template < class M >
+  pair< iterator, bool > try_emplace(const key_type& k, const M& obj) {
+    return (insert_unique(k, obj));
+  }
+
+  // position은 hint, 강제 아님.
+  iterator try_emplace(iterator position, const key_type& k) {
+    return (insert_hint(position, k, mapped_type()));
+  }
+
+  template < class M >
+  iterator try_emplace(iterator position, const key_type& k, const M& obj) {
+    return (insert_hint(position, k, obj));
+  }
+#endif
+
+  /**
+   * insert 성공시
+   * pair(새로운 element를 가리키는 iterator, true) 리턴.
+   * insert 실패시
+   * pair(val과 동일한 Key값 갖고있는 iterator, false) 리턴.
+   */
+  pair< iterator, bool > insert(const value_type& val) {
+    return (insert_unique(val.first, val.second));
+  }
+
+  /**
+   * position은 hint, 강제 아님.
+   * hint가 맞으면 tree를 내려가지 않고 그 자리에 넣는다.
+   */
+  iterator insert(iterator position, const value_type& val) {
+    return (insert_hint(position, val.first, val.second));
+  }
+
+  /**
+   * [first, last) 구간의 element를 insert. 기존 Key와 중복되는 element와,
+   * 구간 안에서 앞에 나온 것과 Key가 같은 element는 추가 X.
+   * end()를 hint로 넣으므로 정렬된 구간은 탐색 없이 뒤에 붙는다.
+   */
+  template < class InputIterator >
+  void insert(InputIterator first, InputIterator last,
+              typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                      InputIterator >::type* = u_nullptr) {
+    for (; first != last; ++first) {
+      insert_hint(this->end(), (*first).first, (*first).second);
+    }
+  }
+
+  void erase(iterator position) { _tree.erase(this->position_of(position)); }
+
+  // erase 성공 시 1, 실패 시 0 리턴.
+  size_type erase(const key_type& k) { return (_tree.erase_key(k)); }
+
+  void erase(iterator first, iterator last) {
+    _tree.erase(this->position_of(first), this->position_of(last));
+  }
+
+  void swap(btree_map& x) {
+    _tree.swap(x._tree);
+    std::swap(this->_comp, x._comp);
+    std::swap(this->_alloc, x._alloc);
+  }
+
+  void clear() { _tree.clear(); }
+
+  key_compare key_comp() const { return (this->_comp); }
+  value_compare value_comp() const { return (value_compare(this->_comp)); }
+
+  iterator find(const key_type& k) {
+    return (this->iterator_at(_tree.find(k)));
+  }
+  const_iterator find(const key_type& k) const {
+    return (this->iterator_at(_tree.find(k)));
+  }
+
+  // map은 Key가 unique하기떄문에, 1 또는 0이다.
+  size_type count(const key_type& k) const {
+    return (_tree.is_key_at(_tree.search(k), k));
+  }
+
+  iterator lower_bound(const key_type& k) {
+    return (this->iterator_at(_tree.lower_bound(k)));
+  }
+  const_iterator lower_bound(const key_type& k) const {
+    return (this->iterator_at(_tree.lower_bound(k)));
+  }
+  iterator upper_bound(const key_type& k) {
+    return (this->iterator_at(_tree.upper_bound(k)));
+  }
+  const_iterator upper_bound(const key_type& k) const {
+    return (this->iterator_at(_tree.upper_bound(k)));
+  }
+
+  pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+  }
+  pair< iterator, iterator > equal_range(const key_type& k) {
+    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+  }
+
+  /**
+   * transparent comparator(Compare::is_transparent)인 경우,
+   * x를 key_type으로 바꾸지 않고 그대로 탐색한다.
+   */
+  template < typename K >
+  typename if_transparent< K, iterator >::type find(const K& x) {
+    return (this->iterator_at(_tree.find(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type find(const K& x) const {
+    return (this->iterator_at(_tree.find(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, size_type >::type count(const K& x) const {
+    return (_tree.is_key_at(_tree.search(x), x));
+  }
+  template < typename K >
+  typename if_transparent< K, iterator >::type lower_bound(const K& x) {
+    return (this->iterator_at(_tree.lower_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type lower_bound(
+      const K& x) const {
+    return (this->iterator_at(_tree.lower_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, iterator >::type upper_bound(const K& x) {
+    return (this->iterator_at(_tree.upper_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type upper_bound(
+      const K& x) const {
+    return (this->iterator_at(_tree.upper_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, pair< iterator, iterator > >::type equal_range(
+      const K& x) {
+    return (ft::make_pair(this->iterator_at(_tree.lower_bound(x)),
+                          this->iterator_at(_tree.upper_bound(x))));
+  }
+  template < typename K >
+  typename if_transparent< K, pair< const_iterator, const_iterator > >::type
+  equal_range(const K& x) const {
+    return (ft::make_pair(this->iterator_at(_tree.lower_bound(x)),
+                          this->iterator_at(_tree.upper_bound(x))));
+  }
+
+  allocator_type get_allocator() const { return (this->_alloc); }
+
+ private:
+  iterator iterator_at(position p) { return (iterator(p.leaf, p.slot)); }
+  const_iterator iterator_at(position p) const {
+    return (const_iterator(p.leaf, p.slot));
+  }
+  position position_of(iterator it) const {
+    return (position(it.leaf(), it.slot()));
+  }
+
+  template < class M >
+  pair< iterator, bool > insert_unique(const key_type& k, const M& obj) {
+    position p = _tree.search(k);
+
+    if (_tree.is_key_at(p, k)) {
+      return (ft::make_pair(this->iterator_at(p), false));
+    }
+    p = _tree.insert_at(p, k, mapped_type(obj));
+    return (ft::make_pair(this->iterator_at(p), true));
+  }
+
+  template < class M >
+  iterator insert_hint(iterator position, const key_type& k, const M& obj) {
+    typename tree_type::position p =
+        _tree.hint_slot(this->position_of(position), k);
+
+    if (!_tree.is_key_at(p, k)) {
+      p = _tree.insert_at(p, k, mapped_type(obj));
+    }
+    return (this->iterator_at(p));
+  }
+};
+
+template < class Key, class T, class Compare, class Alloc, size_t N >
+bool operator==(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+                const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return (lhs.size() == rhs.size() &&
+          ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template < class Key, class T, class Compare, class Alloc, size_t N >
+bool operator!=(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+                const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return (!(lhs == rhs));
+}
+
+template < class Key, class T, class Compare, class Alloc, size_t N >
+bool operator<(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+               const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                      rhs.end()));
+}
+
+template < class Key, class T, class Compare, class Alloc, size_t N >
+bool operator<=(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+                const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return (!(rhs < lhs));
+}
+
+template < class Key, class T, class Compare, class Alloc, size_t N >
+bool operator>(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+               const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return (rhs < lhs);
+}
+
+template < class Key, class T, class Compare, class Alloc, size_t N >
+bool operator>=(const btree_map< Key, T, Compare, Alloc, N >& lhs,
+                const btree_map< Key, T, Compare, Alloc, N >& rhs) {
+  return (!(lhs < rhs));
+}
+
+template < class Key, class T, class Compare, class Alloc, size_t N >
+void swap(btree_map< Key, T, Compare, Alloc, N >& x,
+          btree_map< Key, T, Compare, Alloc, N >& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif  // BTREE_MAP_HPP
@@ -0,0 +1,307 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_set.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(BTREE_SET_HPP)
+#define BTREE_SET_HPP
+
+#include <algorithm>
+#include <memory>
+
+#include "BTree.hpp"
+#include "BTreeIterator.hpp"
+#include "utils.hpp"
+
+namespace ft {
+/**
+ * B+ tree(BTree)에 담는 set. (btree_map 참고)
+ * 인터페이스는 ft::set과 같다. value 자리에는 빈 btree_no_value가 들어간다.
+ * insert / erase 후에는 모든 iterator가 무효가 된다.
+ */
+template < class T, class Compare = ft::less< T >,
+           class Alloc = std::allocator< T >, size_t NodeBytes = 512 >
+class btree_set {
+ public:
+  typedef T key_type;
+  typedef T value_type;
+  typedef Compare key_compare;
+  typedef Compare value_compare;
+  typedef Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+
+ private:
+  typedef ft::BTree< key_type, ft::btree_no_value, key_compare, Alloc,
+                     NodeBytes >
+      tree_type;
+  typedef typename tree_type::leaf_type leaf_type;
+  typedef typename tree_type::position position;
+
+ public:
+  typedef ft::BTreeSetIterator< key_type, leaf_type > iterator;
+  typedef ft::BTreeSetIterator< key_type, leaf_type > const_iterator;
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  typedef typename iterator::difference_type difference_type;
+  typedef size_t size_type;
+
+ private:
+  tree_type _tree;
+  key_compare _comp;
+  allocator_type _alloc;
+
+  // transparent comparator인 경우에만 K로 탐색하는 함수를 허용한다.
+  template < typename K, typename R >
+  struct if_transparent
+      : ft::enable_if< ft::is_transparent< Compare, K >::value, R > {};
+
+ public:
+  explicit btree_set(const key_compare& comp = key_compare(),
+                     const allocator_type& alloc = allocator_type())
+      : _tree(comp, alloc), _comp(comp), _alloc(alloc) {}
+
+  template < class InputIterator >
+  btree_set(InputIterator first, InputIterator last,
+            const key_compare& comp = key_compare(),
+            const allocator_type& alloc = allocator_type(),
+            typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                    InputIterator >::type* = u_nullptr)
+      : _tree(comp, alloc), _comp(comp), _alloc(alloc) {
+    insert(first, last);
+  }
+
+  btree_set(const btree_set& x)
+      : _tree(x._tree), _comp(x._comp), _alloc(x._alloc) {}
+
+  virtual ~btree_set() {}
+
+  btree_set& operator=(const btree_set& x) {
+    if (this != &x) {
+      btree_set tmp(x);
+      this->swap(tmp);
+    }
+    return (*this);
+  }
+
+#if __cplusplus >= 201103L
+  // 빈 tree를 만든 뒤 x와 바꾼다. x는 빈 btree_set으로 남는다.
+  btree_set(btree_set&& x)
+      : _tree(x._comp, x._alloc), _comp(x._comp), _alloc(x._alloc) {
+    this->swap(x);
+  }
+
+  btree_set& operator=(btree_set&& x) {
+    if (this != &x) {
+      this->clear();
+      this->swap(x);
+    }
+    return (*this);
+  }
+#endif
+
+  const_iterator begin() const { return (this->iterator_at(_tree.begin())); }
+  const_iterator end() const { return (this->iterator_at(_tree.end())); }
+  const_reverse_iterator rbegin() const {
+    return (const_reverse_iterator(this->end()));
+  }
+  const_reverse_iterator rend() const {
+    return (const_reverse_iterator(this->begin()));
+  }
+
+  bool empty() const { return (_tree.empty()); }
+  size_type size() const { return (_tree.size()); }
+  size_type max_size() const { return (_tree.max_size()); }
+
+  /**
+   * insert 성공시
+   * pair(새로운 element를 가리키는 iterator, true) 리턴.
+   * insert 실패시
+   * pair(val과 동일한 Key값 갖고있는 iterator, false) 리턴.
+   */
+  pair< iterator, bool > insert(const value_type& val) {
+    position p = _tree.search(val);
+
+    if (_tree.is_key_at(p, val)) {
+      return (ft::make_pair(this->iterator_at(p), false));
+    }
+    p = _tree.insert_at(p, val, ft::btree_no_value());
+    return (ft::make_pair(this->iterator_at(p), true));
+  }
+
+  /**
+   * position은 hint, 강제 아님.
+   * hint가 맞으면 tree를 내려가지 않고 그 자리에 넣는다.
+   */
+  iterator insert(iterator position, const value_type& val) {
+    typename tree_type::position p =
+        _tree.hint_slot(this->position_of(position), val);
+
+    if (!_tree.is_key_at(p, val)) {
+      p = _tree.insert_at(p, val, ft::btree_no_value());
+    }
+    return (this->iterator_at(p));
+  }
+
+#if __cplusplus >= 201103L
+  // args로 value를 만들어 insert 한다. 같은 값이 있으면 만든 것은 버린다.
+  template < class... Args >
+  pair< iterator, bool > emplace(Args&&... args) {
+    return (insert(value_type(std::forward< Args >(args)...)));
+  }
+
+  template < class... Args >
+  iterator emplace_hint(iterator position, Args&&... args) {
+    return (insert(position, value_type(std::forward< Args >(args)...)));
+  }
+#endif
+
+  /**
+   * [first, last) 구간의 element를 insert. 중복되는 element는 추가 X.
+   * end()를 hint로 넣으므로 정렬된 구간은 탐색 없이 뒤에 붙는다.
+   */
+  template < class InputIterator >
+  void insert(InputIterator first, InputIterator last,
+              typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                      InputIterator >::type* = u_nullptr) {
+    for (; first != last; ++first) {
+      insert(this->end(), *first);
+    }
+  }
+
+  void erase(iterator position) { _tree.erase(this->position_of(position)); }
+
+  // erase 성공 시 1, 실패 시 0 리턴.
+  size_type erase(const key_type& k) { return (_tree.erase_key(k)); }
+
+  void erase(iterator first, iterator last) {
+    _tree.erase(this->position_of(first), this->position_of(last));
+  }
+
+  void swap(btree_set& x) {
+    _tree.swap(x._tree);
+    std::swap(this->_comp, x._comp);
+    std::swap(this->_alloc, x._alloc);
+  }
+
+  void clear() { _tree.clear(); }
+
+  key_compare key_comp() const { return (this->_comp); }
+  value_compare value_comp() const { return (this->_comp); }
+
+  const_iterator find(const key_type& k) const {
+    return (this->iterator_at(_tree.find(k)));
+  }
+
+  // set은 Key가 unique하기떄문에, 1 또는 0이다.
+  size_type count(const key_type& k) const {
+    return (_tree.is_key_at(_tree.search(k), k));
+  }
+
+  const_iterator lower_bound(const key_type& k) const {
+    return (this->iterator_at(_tree.lower_bound(k)));
+  }
+  const_iterator upper_bound(const key_type& k) const {
+    return (this->iterator_at(_tree.upper_bound(k)));
+  }
+
+  pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+  }
+
+  /**
+   * transparent comparator(Compare::is_transparent)인 경우,
+   * x를 key_type으로 바꾸지 않고 그대로 탐색한다.
+   */
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type find(const K& x) const {
+    return (this->iterator_at(_tree.find(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, size_type >::type count(const K& x) const {
+    return (_tree.is_key_at(_tree.search(x), x));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type lower_bound(
+      const K& x) const {
+    return (this->iterator_at(_tree.lower_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type upper_bound(
+      const K& x) const {
+    return (this->iterator_at(_tree.upper_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, pair< const_iterator, const_iterator > >::type
+  equal_range(const K& x) const {
+    return (ft::make_pair(this->iterator_at(_tree.lower_bound(x)),
+                          this->iterator_at(_tree.upper_bound(x))));
+  }
+
+  allocator_type get_allocator() const { return (this->_alloc); }
+
+ private:
+  const_iterator iterator_at(position p) const {
+    return (const_iterator(p.leaf, p.slot));
+  }
+  position position_of(const_iterator it) const {
+    return (position(it.leaf(), it.slot()));
+  }
+};
+
+template < class T, class Compare, class Alloc, size_t N >
+bool operator==(const btree_set< T, Compare, Alloc, N >& lhs,
+                const btree_set< T, Compare, Alloc, N >& rhs) {
+  return (lhs.size() == rhs.size() &&
+          ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template < class T, class Compare, class Alloc, size_t N >
+bool operator!=(const btree_set< T, Compare, Alloc, N >& lhs,
+                const btree_set< T, Compare, Alloc, N >& rhs) {
+  return (!(lhs == rhs));
+}
+
+template < class T, class Compare, class Alloc, size_t N >
+bool operator<(const btree_set< T, Compare, Alloc, N >& lhs,
+               const btree_set< T, Compare, Alloc, N >& rhs) {
+  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                      rhs.end()));
+}
+
+template < class T, class Compare, class Alloc, size_t N >
+bool operator<=(const btree_set< T, Compare, Alloc, N >& lhs,
+                const btree_set< T, Compare, Alloc, N >& rhs) {
+  return (!(rhs < lhs));
+}
+
+template < class T, class Compare, class Alloc, size_t N >
+bool operator>(const btree_set< T, Compare, Alloc, N >& lhs,
+               const btree_set< T, Compare, Alloc, N >& rhs) {
+  return (rhs < lhs);
+}
+
+template < class T, class Compare, class Alloc, size_t N >
+bool operator>=(const btree_set< T, Compare, Alloc, N >& lhs,
+                const btree_set< T, Compare, Alloc, N >& rhs) {
+  return (!(lhs < rhs));
+}
+
+template < class T, class Compare, class Alloc, size_t N >
+void swap(btree_set< T, Compare, Alloc, N >& x,
+          btree_set< T, Compare, Alloc, N >& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif  // BTREE_SET_HPP
@@ -0,0 +1,216 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   counting_allocator.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(COUNTING_ALLOCATOR_HPP)
+#define COUNTING_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
+namespace ft {
+
+/**
+ * counting_allocator가 기록하는 숫자들.
+ * allocate / deallocate 횟수, 사용 중인 byte와 그 최댓값을 센다.
+ *
+ * begin_ops()와 end_op()로 연산 구간을 나누면, 연산 하나가 allocate를
+ * 몇 번 했는지의 histogram과 구간 전체의 allocate / deallocate 횟수,
+ * 구간 동안 늘어난 최대 byte도 남긴다.
+ * (마지막 end_op() 뒤의 deallocate는 구간에 들어가지 않는다)
+ */
+struct alloc_stats {
+  // histogram[i]: allocate를 i번 한 연산의 갯수. 마지막 칸은 그 이상.
+  static const size_t histogram_size = 8;
+
+  size_t allocations;
+  size_t deallocations;
+  size_t bytes_in_use;
+  size_t peak_bytes;
+
+  size_t ops;
+  size_t op_allocations;
+  size_t op_deallocations;
+  size_t op_peak_bytes;
+  size_t histogram[histogram_size];
+
+ private:
+  size_t _begin_alloc;
+  size_t _begin_dealloc;
+  size_t _begin_bytes;
+  size_t _last_alloc;
+
+ public:
+  alloc_stats() { reset(); }
+
+  void reset() {
+    this->allocations = 0;
+    this->deallocations = 0;
+    this->bytes_in_use = 0;
+    this->peak_bytes = 0;
+    begin_ops();
+  }
+
+  // 지금부터 연산 구간을 새로 센다. (전체 숫자는 그대로 둔다)
+  void begin_ops() {
+    this->ops = 0;
+    this->op_allocations = 0;
+    this->op_deallocations = 0;
+    this->op_peak_bytes = 0;
+    for (size_t i = 0; i < histogram_size; ++i) {
+      this->histogram[i] = 0;
+    }
+    this->_begin_alloc = this->allocations;
+    this->_begin_dealloc = this->deallocations;
+    this->_begin_bytes = this->bytes_in_use;
+    this->_last_alloc = this->allocations;
+  }
+
+  // 직전 end_op() (또는 begin_ops()) 이후를 연산 하나로 센다.
+  void end_op() {
+    size_t n = this->allocations - this->_last_alloc;
+
+    ++this->histogram[n < histogram_size ? n : histogram_size - 1];
+    ++this->ops;
+    this->op_allocations = this->allocations - this->_begin_alloc;
+    this->op_deallocations = this->deallocations - this->_begin_dealloc;
+    this->_last_alloc = this->allocations;
+  }
+
+  void on_allocate(size_t bytes) {
+    ++this->allocations;
+    this->bytes_in_use += bytes;
+    if (this->bytes_in_use > this->peak_bytes) {
+      this->peak_bytes = this->bytes_in_use;
+    }
+    if (this->bytes_in_use > this->_begin_bytes &&
+        this->bytes_in_use - this->_begin_bytes > this->op_peak_bytes) {
+      this->op_peak_bytes = this->bytes_in_use - this->_begin_bytes;
+    }
+  }
+
+  void on_deallocate(size_t bytes) {
+    ++this->deallocations;
+    this->bytes_in_use -= bytes;
+  }
+};
+
+// stats를 따로 주지 않은 counting_allocator가 모두 같이 쓰는 기록.
+inline alloc_stats& default_alloc_stats() {
+  static alloc_stats stats;
+
+  return (stats);
+}
+
+/**
+ * Alloc을 감싸서 allocate / deallocate를 alloc_stats에 기록하는 allocator.
+ * container의 Allocator 자리에 그대로 넣을 수 있다.
+ *   ft::map< K, V, C, ft::counting_allocator< ft::pair< const K, V > > >
+ *
+ * rebind나 복사로 만든 allocator는 같은 alloc_stats에 기록하므로,
+ * RB_Tree가 rebind한 node allocator의 allocate도 map의 stats에 잡힌다.
+ * 기록하는 byte는 n * sizeof(T) 이다. (Alloc 내부의 overhead는 모른다)
+ */
+template < typename T, typename Alloc = std::allocator< T > >
+class counting_allocator {
+ public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+  template < typename U >
+  struct rebind {
+    typedef counting_allocator< U, typename Alloc::template rebind< U >::other >
+        other;
+  };
+
+ private:
+  Alloc _base;
+  alloc_stats* _stats;
+
+  template < typename U, typename A >
+  friend class counting_allocator;
+
+ public:
+  counting_allocator() : _base(), _stats(&default_alloc_stats()) {}
+
+  explicit counting_allocator(alloc_stats& stats,
+                              const Alloc& base = Alloc())
+      : _base(base), _stats(&stats) {}
+
+  counting_allocator(const counting_allocator& other)
+      : _base(other._base), _stats(other._stats) {}
+
+  template < typename U, typename A >
+  counting_allocator(const counting_allocator< U, A >& other)
+      : _base(other._base), _stats(other._stats) {}
+
+  ~counting_allocator() {}
+
+  counting_allocator& operator=(const counting_allocator& other) {
+    this->_base = other._base;
+    this->_stats = other._stats;
+    return (*this);
+  }
+
+  alloc_stats& stats() const { return (*this->_stats); }
+
+  pointer address(reference x) const { return (&x); }
+  const_pointer address(const_reference x) const { return (&x); }
+
+  pointer allocate(size_type n, const void* = 0) {
+    pointer p = this->_base.allocate(n);
+
+    this->_stats->on_allocate(n * sizeof(T));
+    return (p);
+  }
+
+  void deallocate(pointer p, size_type n) {
+    this->_stats->on_deallocate(n * sizeof(T));
+    this->_base.deallocate(p, n);
+  }
+
+  size_type max_size() const { return (this->_base.max_size()); }
+
+#if __cplusplus >= 201103L
+  template < typename U, typename... Args >
+  void construct(U* p, Args&&... args) {
+    new (p) U(std::forward< Args >(args)...);
+  }
+#else
+  void construct(pointer p, const_reference val) { new (p) T(val); }
+#endif
+  void destroy(pointer p) { p->~T(); }
+
+  // 같은 stats에 기록하고 감싼 allocator끼리 같아야 서로의 메모리를
+  // 반환할 수 있다. (다른 stats로 반환하면 숫자가 맞지 않는다)
+  template < typename U, typename A >
+  bool operator==(const counting_allocator< U, A >& other) const {
+    return (this->_stats == other._stats && this->_base == other._base);
+  }
+
+  template < typename U, typename A >
+  bool operator!=(const counting_allocator< U, A >& other) const {
+    return (!(*this == other));
+  }
+};
+
+}  // namespace ft
+
+#endif  // COUNTING_ALLOCATOR_HPP
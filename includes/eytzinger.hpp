@@ -0,0 +1,270 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   eytzinger.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(EYTZINGER_HPP)
+#define EYTZINGER_HPP
+
+#include <cstddef>
+
+#include "FlatMapIterator.hpp"
+#include "iterator.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft {
+/**
+ * Eytzinger(BFS) 순서로 정렬된 배열을 다루는 함수 모음.
+ * (frozen_map, frozen_set이 쓴다)
+ *
+ * index는 1부터 n까지이고 i의 자식은 2i, 2i + 1이다. 실제 배열에서는
+ * keys[i - 1]에 있다. 0은 end를 뜻한다.
+ * 정렬된 배열의 binary search와 같은 key를 비교하지만, 위쪽 몇 단계가
+ * 배열 앞쪽 몇 개의 cache line에 모여 있어서 항상 cache에 남는다.
+ * 그리고 다음 몇 단계의 자손들이 이어져 있어서 미리 prefetch 할 수 있다.
+ */
+struct eytzinger {
+  // key 순서로 첫 번째 index. (가장 왼쪽 아래)
+  static size_t first(size_t n) {
+    size_t i = (n == 0) ? 0 : 1;
+
+    while (i != 0 && 2 * i <= n) i = 2 * i;
+    return (i);
+  }
+
+  // key 순서로 마지막 index. (가장 오른쪽 아래)
+  static size_t last(size_t n) {
+    size_t i = (n == 0) ? 0 : 1;
+
+    while (i != 0 && 2 * i + 1 <= n) i = 2 * i + 1;
+    return (i);
+  }
+
+  // key 순서로 다음 index. 마지막 다음은 0.
+  static size_t next(size_t i, size_t n) {
+    if (2 * i + 1 <= n) {
+      i = 2 * i + 1;
+      while (2 * i <= n) i = 2 * i;
+      return (i);
+    }
+    // 오른쪽 자식이었던 동안 올라가고, 한 번 더 올라간 곳이 다음.
+    while (i & 1) i >>= 1;
+    return (i >> 1);
+  }
+
+  // key 순서로 이전 index. 0(end)의 이전은 마지막.
+  static size_t prev(size_t i, size_t n) {
+    if (i == 0) return (last(n));
+    if (2 * i <= n) {
+      i = 2 * i;
+      while (2 * i + 1 <= n) i = 2 * i + 1;
+      return (i);
+    }
+    while (i != 0 && !(i & 1)) i >>= 1;
+    return (i >> 1);
+  }
+
+  /**
+   * rank_of[i - 1]에 index i 자리에 올 element의 key 순서(0부터)를 채운다.
+   * 정렬된 배열에서 rank_of 순서대로 push_back 하면 Eytzinger 배열이 된다.
+   * O(n)
+   */
+  static void ranks(ft::vector< size_t >& rank_of, size_t n) {
+    rank_of.assign(n, 0);
+    for (size_t i = first(n), r = 0; i != 0; i = next(i, n), ++r) {
+      rank_of[i - 1] = r;
+    }
+  }
+
+  /**
+   * keys에서 k보다 작지 않은 첫 key의 index. 없으면 0.
+   * 한 단계마다 왼쪽/오른쪽을 비교 결과(0 / 1)로 더해서 내려가므로 분기가
+   * 없다. 끝까지 내려간 뒤, 마지막으로 왼쪽으로 간 곳이 답이다.
+   * (i의 아래쪽 연속된 1은 그 뒤로 오른쪽으로 간 단계들)
+   * 내려가는 동안 prefetch 단계 아래의 자손들이 있는 cache line을 미리
+   * 읽어둔다. (범위를 넘는 주소여도 prefetch는 fault를 내지 않는다)
+   */
+  template < typename Key, typename K, typename Compare >
+  static size_t lower_bound(const Key* keys, size_t n, const K& k,
+                            const Compare& comp) {
+    size_t i = 1;
+
+    while (i <= n) {
+      prefetch(keys, i);
+      i = 2 * i + comp(keys[i - 1], k);
+    }
+    return (climb(i));
+  }
+
+  // keys에서 k보다 큰 첫 key의 index. 없으면 0.
+  template < typename Key, typename K, typename Compare >
+  static size_t upper_bound(const Key* keys, size_t n, const K& k,
+                            const Compare& comp) {
+    size_t i = 1;
+
+    while (i <= n) {
+      prefetch(keys, i);
+      i = 2 * i + !comp(k, keys[i - 1]);
+    }
+    return (climb(i));
+  }
+
+  // k와 같은 key의 index. 없으면 0.
+  template < typename Key, typename K, typename Compare >
+  static size_t find(const Key* keys, size_t n, const K& k,
+                     const Compare& comp) {
+    size_t i = lower_bound(keys, n, k, comp);
+
+    return ((i != 0 && !comp(k, keys[i - 1])) ? i : 0);
+  }
+
+ private:
+  /**
+   * i 아래로 log2(block)번째 자손들. block개가 이어져 있으므로 key가 작으면
+   * 한 cache line에 들어간다. 그 단계에 갈 때쯤 이미 cache에 있다.
+   */
+  template < typename Key >
+  static void prefetch(const Key* keys, size_t i) {
+    static const size_t line = 64;
+    static const size_t block =
+        (sizeof(Key) < line) ? line / sizeof(Key) : 1;
+
+    __builtin_prefetch(
+        reinterpret_cast< const char* >(keys) + (block * i - 1) * sizeof(Key));
+  }
+
+  // 아래쪽 연속된 1(오른쪽으로 간 단계)을 지우고 한 단계 더 올라간다.
+  static size_t climb(size_t i) { return (i >> (__builtin_ctzl(~i) + 1)); }
+};
+
+/**
+ * frozen_map의 iterator. key 순서로 움직인다. (bidirectional)
+ * 역참조하면 flat_map과 같은 flat_map_reference를 리턴한다.
+ */
+template < typename Key, typename T >
+class FrozenMapIterator {
+ public:
+  typedef ft::pair< const Key, T > value_type;
+  typedef ft::flat_map_reference< Key, const T > reference;
+  typedef ft::flat_map_reference< Key, const T > pointer;
+  typedef ptrdiff_t difference_type;
+  typedef ft::bidirectional_iterator_tag iterator_category;
+
+ protected:
+  const Key* _keys;
+  const T* _values;
+  size_t _index;
+  size_t _size;
+
+ public:
+  FrozenMapIterator(const Key* keys = u_nullptr, const T* values = u_nullptr,
+                    size_t index = 0, size_t size = 0)
+      : _keys(keys), _values(values), _index(index), _size(size) {}
+
+  // Eytzinger index. (0이면 end)
+  size_t base() const { return (this->_index); }
+
+  reference operator*() const {
+    return (reference(this->_keys[this->_index - 1],
+                      this->_values[this->_index - 1]));
+  }
+
+  pointer operator->() const { return (operator*()); }
+
+  FrozenMapIterator& operator++() {
+    this->_index = eytzinger::next(this->_index, this->_size);
+    return (*this);
+  }
+
+  FrozenMapIterator operator++(int) {
+    FrozenMapIterator tmp = *this;
+    ++*this;
+    return (tmp);
+  }
+
+  FrozenMapIterator& operator--() {
+    this->_index = eytzinger::prev(this->_index, this->_size);
+    return (*this);
+  }
+
+  FrozenMapIterator operator--(int) {
+    FrozenMapIterator tmp = *this;
+    --*this;
+    return (tmp);
+  }
+
+  bool operator==(const FrozenMapIterator& other) const {
+    return (this->_index == other._index && this->_keys == other._keys);
+  }
+  bool operator!=(const FrozenMapIterator& other) const {
+    return (!(*this == other));
+  }
+};
+
+// frozen_set의 iterator. key 순서로 움직인다. (bidirectional)
+template < typename Key >
+class FrozenSetIterator
+    : public ft::iterator< ft::bidirectional_iterator_tag, const Key > {
+ public:
+  typedef Key value_type;
+  typedef const Key& reference;
+  typedef const Key* pointer;
+
+ protected:
+  const Key* _keys;
+  size_t _index;
+  size_t _size;
+
+ public:
+  FrozenSetIterator(const Key* keys = u_nullptr, size_t index = 0,
+                    size_t size = 0)
+      : _keys(keys), _index(index), _size(size) {}
+
+  // Eytzinger index. (0이면 end)
+  size_t base() const { return (this->_index); }
+
+  reference operator*() const { return (this->_keys[this->_index - 1]); }
+
+  pointer operator->() const { return (&(operator*())); }
+
+  FrozenSetIterator& operator++() {
+    this->_index = eytzinger::next(this->_index, this->_size);
+    return (*this);
+  }
+
+  FrozenSetIterator operator++(int) {
+    FrozenSetIterator tmp = *this;
+    ++*this;
+    return (tmp);
+  }
+
+  FrozenSetIterator& operator--() {
+    this->_index = eytzinger::prev(this->_index, this->_size);
+    return (*this);
+  }
+
+  FrozenSetIterator operator--(int) {
+    FrozenSetIterator tmp = *this;
+    --*this;
+    return (tmp);
+  }
+
+  bool operator==(const FrozenSetIterator& other) const {
+    return (this->_index == other._index && this->_keys == other._keys);
+  }
+  bool operator!=(const FrozenSetIterator& other) const {
+    return (!(*this == other));
+  }
+};
+
+}  // namespace ft
+
+#endif  // EYTZINGER_HPP
@@ -0,0 +1,619 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_map.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(FLAT_MAP_HPP)
+#define FLAT_MAP_HPP
+
+#include <algorithm>
+#include <memory>
+
+#include "FlatMapIterator.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft {
+/**
+ * 정렬된 ft::vector 두 개(key 배열, value 배열)에 담는 map.
+ * 인터페이스는 ft::map과 같고, 탐색은 key 배열에서의 binary search다.
+ * key만 연속으로 모여 있으므로 탐색 중에 value를 cache에 올리지 않고,
+ * element마다 할당이 없다. 대신 중간 insert / erase는 O(n)이고,
+ * insert / erase 후에는 모든 iterator가 무효가 된다. (vector와 같음)
+ * 많이 넣을 때는 insert(first, last)로 한 번에 넣는다.
+ */
+template < class Key, class T, class Compare = ft::less< Key >,
+           class Alloc = std::allocator< ft::pair< const Key, T > > >
+class flat_map {
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef ft::pair< const key_type, mapped_type > value_type;
+  typedef Compare key_compare;
+
+  class value_compare : ft::binary_function< value_type, value_type, bool > {
+    friend class flat_map;
+
+   protected:
+    Compare comp;
+    value_compare(Compare c) : comp(c) {}
+
+   public:
+    typedef bool result_type;
+    typedef value_type first_argument_type;
+    typedef value_type second_argument_type;
+    value_compare() : comp() {}
+    bool operator()(const value_type& x, const value_type& y) const {
+      return comp(x.first, y.first);
+    }
+  };
+
+  typedef Alloc allocator_type;
+  typedef ft::FlatMapIterator< key_type, mapped_type > iterator;
+  typedef ft::FlatMapIterator< key_type, const mapped_type > const_iterator;
+  typedef typename iterator::reference reference;
+  typedef typename const_iterator::reference const_reference;
+  typedef typename iterator::pointer pointer;
+  typedef typename const_iterator::pointer const_pointer;
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  typedef typename iterator::difference_type difference_type;
+  typedef size_t size_type;
+
+ private:
+  typedef typename Alloc::template rebind< key_type >::other key_alloc_type;
+  typedef typename Alloc::template rebind< mapped_type >::other
+      mapped_alloc_type;
+  typedef ft::vector< key_type, key_alloc_type > key_vector;
+  typedef ft::vector< mapped_type, mapped_alloc_type > mapped_vector;
+
+  // insert(first, last)에서 정렬하려고 잠깐 모아두는 element.
+  typedef ft::pair< key_type, mapped_type > entry_type;
+  typedef typename Alloc::template rebind< entry_type >::other
+      entry_alloc_type;
+  typedef ft::vector< entry_type, entry_alloc_type > entry_vector;
+
+  struct entry_compare {
+    Compare comp;
+    entry_compare(const Compare& c) : comp(c) {}
+    bool operator()(const entry_type& x, const entry_type& y) const {
+      return (comp(x.first, y.first));
+    }
+  };
+
+  key_vector _keys;
+  mapped_vector _values;
+  key_compare _comp;
+  allocator_type _alloc;
+
+  // transparent comparator인 경우에만 K로 탐색하는 함수를 허용한다.
+  template < typename K, typename R >
+  struct if_transparent
+      : ft::enable_if< ft::is_transparent< Compare, K >::value, R > {};
+
+ public:
+  explicit flat_map(const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type())
+      : _keys(key_alloc_type(alloc)),
+        _values(mapped_alloc_type(alloc)),
+        _comp(comp),
+        _alloc(alloc) {}
+
+  template < class InputIterator >
+  flat_map(InputIterator first, InputIterator last,
+           const key_compare& comp = key_compare(),
+           const allocator_type& alloc = allocator_type(),
+           typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                   InputIterator >::type* = u_nullptr)
+      : _keys(key_alloc_type(alloc)),
+        _values(mapped_alloc_type(alloc)),
+        _comp(comp),
+        _alloc(alloc) {
+    insert(first, last);
+  }
+
+  flat_map(const flat_map& x)
+      : _keys(x._keys), _values(x._values), _comp(x._comp), _alloc(x._alloc) {}
+
+  virtual ~flat_map() {}
+
+  // 복사본을 다 만든 뒤 바꾼다. (중간에 예외가 나도 *this는 그대로)
+  flat_map& operator=(const flat_map& x) {
+    if (this != &x) {
+      flat_map tmp(x);
+      this->swap(tmp);
+    }
+    return (*this);
+  }
+
+#if __cplusplus >= 201103L
+  // 빈 배열을 만든 뒤 x와 바꾼다. x는 빈 flat_map으로 남는다.
+  flat_map(flat_map&& x)
+      : _keys(key_alloc_type(x._alloc)),
+        _values(mapped_alloc_type(x._alloc)),
+        _comp(x._comp),
+        _alloc(x._alloc) {
+    this->swap(x);
+  }
+
+  flat_map& operator=(flat_map&& x) {
+    if (this != &x) {
+      this->clear();
+      this->swap(x);
+    }
+    return (*this);
+  }
+#endif
+
+  iterator begin() { return (this->iterator_at(0)); }
+  const_iterator begin() const { return (this->iterator_at(0)); }
+  iterator end() { return (this->iterator_at(this->size())); }
+  const_iterator end() const { return (this->iterator_at(this->size())); }
+
+  reverse_iterator rbegin() { return (reverse_iterator(this->end())); }
+  const_reverse_iterator rbegin() const {
+    return (const_reverse_iterator(this->end()));
+  }
+  reverse_iterator rend() { return (reverse_iterator(this->begin())); }
+  const_reverse_iterator rend() const {
+    return (const_reverse_iterator(this->begin()));
+  }
+
+  bool empty() const { return (_keys.empty()); }
+  size_type size() const { return (_keys.size()); }
+  size_type max_size() const {
+    return (std::min(_keys.max_size(), _values.max_size()));
+  }
+
+  // 두 배열의 capacity를 같이 다룬다. (insert 중 재할당을 피할 때)
+  void reserve(size_type n) {
+    _keys.reserve(n);
+    _values.reserve(n);
+  }
+  size_type capacity() const {
+    return (std::min(_keys.capacity(), _values.capacity()));
+  }
+  void shrink_to_fit() {
+    _keys.shrink_to_fit();
+    _values.shrink_to_fit();
+  }
+
+  // k가 없을 때만 mapped_type()을 insert 한다.
+  mapped_type& operator[](const key_type& k) {
+    return (try_emplace(k).first->second);
+  }
+
+#if __cplusplus >= 201103L
+  /**
+   * k가 없으면 (k, mapped_type(args...))를 insert 한다.
+   * k가 이미 있으면 아무것도 만들지 않고 그 element를 리턴한다.
+   * 리턴값은 insert(val)과 같다.
+   */
+  template < class... Args >
+  pair< iterator, bool > try_emplace(const key_type& k, Args&&... args) {
+    size_type i = this->lower_index(k);
+
+    if (this->is_key_at(i, k)) {
+      return (ft::make_pair(this->iterator_at(i), false));
+    }
+    this->insert_at(i, k, mapped_type(std::forward< Args >(args)...));
+    return (ft::make_pair(this->iterator_at(i), true));
+  }
+
+  // position은 hint, 강제 아님.
+  template < class... Args >
+  iterator try_emplace(iterator position, const key_type& k, Args&&... args) {
+    size_type i = this->hint_index(position, k);
+
+    if (this->is_key_at(i, k)) {
+      return (this->iterator_at(i));
+    }
+    this->insert_at(i, k, mapped_type(std::forward< Args >(args)...));
+    return (this->iterator_at(i));
+  }
+
+  // args로 value_type을 먼저 만들어야 key를 알 수 있다.
+  template < class... Args >
+  pair< iterator, bool > emplace(Args&&... args) {
+    return (insert(value_type(std::forward< Args >(args)...)));
+  }
+
+  template < class... Args >
+  iterator emplace_hint(iterator position, Args&&... args) {
+    return (insert(position, value_type(std::forward< Args >(args)...)));
+  }
+#else
+  /**
+   * k가 없으면 (k, mapped_type(obj))를 insert 한다.
+   * k가 이미 있으면 아무것도 만들지 않고 그 element를 리턴한다.
+   * 리턴값은 insert(val)과 같다.
+   */
+  pair< iterator, bool > try_emplace(const key_type& k) {
+    return (insert_unique(k, mapped_type()));
+  }
+
+  template < class M >
+  pair< iterator, bool > try_emplace(const key_type& k, const M& obj) {
+    return (insert_unique(k, obj));
+  }
+
+  // position은 hint, 강제 아님.
+  iterator try_emplace(iterator position, const key_type& k) {
+    return (insert_hint(position, k, mapped_type()));
+  }
+
+  template < class M >
+  iterator try_emplace(iterator position, const key_type& k, const M& obj) {
+    return (insert_hint(position, k, obj));
+  }
+#endif
+
+  /**
+   * insert 성공시
+   * pair(새로운 element를 가리키는 iterator, true) 리턴.
+   * insert 실패시
+   * pair(val과 동일한 Key값 갖고있는 iterator, false) 리턴.
+   */
+  pair< iterator, bool > insert(const value_type& val) {
+    return (insert_unique(val.first, val.second));
+  }
+
+  /**
+   * position은 hint, 강제 아님.
+   * hint가 맞으면 binary search 없이 그 자리에 넣는다.
+   */
+  iterator insert(iterator position, const value_type& val) {
+    return (insert_hint(position, val.first, val.second));
+  }
+
+  /**
+   * [first, last) 구간의 element를 insert. 기존 Key와 중복되는 element와,
+   * 구간 안에서 앞에 나온 것과 Key가 같은 element는 추가 X.
+   * 하나씩 넣으면 매번 뒤쪽을 밀어야 하므로, 따로 모아서 한 번 정렬한 뒤
+   * 기존 배열과 한 번에 merge 한다. O(n + m log m)
+   */
+  template < class InputIterator >
+  void insert(InputIterator first, InputIterator last,
+              typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                      InputIterator >::type* = u_nullptr) {
+    entry_vector entries(entry_alloc_type(this->_alloc));
+
+    for (; first != last; ++first) {
+      entries.push_back(entry_type((*first).first, (*first).second));
+    }
+    if (entries.empty()) return;
+
+    entry_type* sorted = entries.begin().base();
+    std::stable_sort(sorted, sorted + entries.size(),
+                     entry_compare(this->_comp));
+    this->merge_sorted(sorted, sorted + entries.size());
+  }
+
+  void erase(iterator position) {
+    size_type i = position - this->begin();
+
+    _keys.erase(_keys.begin() + i);
+    _values.erase(_values.begin() + i);
+  }
+
+  // erase 성공 시 1, 실패 시 0 리턴.
+  size_type erase(const key_type& k) {
+    size_type i = this->lower_index(k);
+
+    if (!this->is_key_at(i, k)) return (0);
+    this->erase(this->iterator_at(i));
+    return (1);
+  }
+
+  void erase(iterator first, iterator last) {
+    size_type i = first - this->begin();
+    size_type j = last - this->begin();
+
+    _keys.erase(_keys.begin() + i, _keys.begin() + j);
+    _values.erase(_values.begin() + i, _values.begin() + j);
+  }
+
+  void swap(flat_map& x) {
+    _keys.swap(x._keys);
+    _values.swap(x._values);
+    std::swap(this->_comp, x._comp);
+    std::swap(this->_alloc, x._alloc);
+  }
+
+  void clear() {
+    _keys.clear();
+    _values.clear();
+  }
+
+  key_compare key_comp() const { return (this->_comp); }
+  value_compare value_comp() const { return (value_compare(this->_comp)); }
+
+  iterator find(const key_type& k) {
+    return (this->iterator_at(this->find_index(k)));
+  }
+  const_iterator find(const key_type& k) const {
+    return (this->iterator_at(this->find_index(k)));
+  }
+
+  // map은 Key가 unique하기떄문에, 1 또는 0이다.
+  size_type count(const key_type& k) const {
+    return (this->find_index(k) != this->size());
+  }
+
+  iterator lower_bound(const key_type& k) {
+    return (this->iterator_at(this->lower_index(k)));
+  }
+  const_iterator lower_bound(const key_type& k) const {
+    return (this->iterator_at(this->lower_index(k)));
+  }
+  iterator upper_bound(const key_type& k) {
+    return (this->iterator_at(this->upper_index(k)));
+  }
+  const_iterator upper_bound(const key_type& k) const {
+    return (this->iterator_at(this->upper_index(k)));
+  }
+
+  pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+  }
+  pair< iterator, iterator > equal_range(const key_type& k) {
+    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+  }
+
+  /**
+   * transparent comparator(Compare::is_transparent)인 경우,
+   * x를 key_type으로 바꾸지 않고 그대로 탐색한다.
+   */
+  template < typename K >
+  typename if_transparent< K, iterator >::type find(const K& x) {
+    return (this->iterator_at(this->find_index(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type find(const K& x) const {
+    return (this->iterator_at(this->find_index(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, size_type >::type count(const K& x) const {
+    return (this->find_index(x) != this->size());
+  }
+  template < typename K >
+  typename if_transparent< K, iterator >::type lower_bound(const K& x) {
+    return (this->iterator_at(this->lower_index(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type lower_bound(
+      const K& x) const {
+    return (this->iterator_at(this->lower_index(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, iterator >::type upper_bound(const K& x) {
+    return (this->iterator_at(this->upper_index(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type upper_bound(
+      const K& x) const {
+    return (this->iterator_at(this->upper_index(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, pair< iterator, iterator > >::type equal_range(
+      const K& x) {
+    return (ft::make_pair(this->iterator_at(this->lower_index(x)),
+                          this->iterator_at(this->upper_index(x))));
+  }
+  template < typename K >
+  typename if_transparent< K, pair< const_iterator, const_iterator > >::type
+  equal_range(const K& x) const {
+    return (ft::make_pair(this->iterator_at(this->lower_index(x)),
+                          this->iterator_at(this->upper_index(x))));
+  }
+
+  allocator_type get_allocator() const { return (this->_alloc); }
+
+ private:
+  const key_type* key_data() const { return (_keys.begin().base()); }
+  mapped_type* value_data() { return (_values.begin().base()); }
+  const mapped_type* value_data() const { return (_values.begin().base()); }
+
+  iterator iterator_at(size_type i) {
+    return (iterator(this->key_data() + i, this->value_data() + i));
+  }
+  const_iterator iterator_at(size_type i) const {
+    return (const_iterator(this->key_data() + i, this->value_data() + i));
+  }
+
+  // k보다 작지 않은 첫 key의 index.
+  template < typename K >
+  size_type lower_index(const K& k) const {
+    const key_type* keys = this->key_data();
+    return (std::lower_bound(keys, keys + this->size(), k, this->_comp) -
+            keys);
+  }
+
+  // k보다 큰 첫 key의 index.
+  template < typename K >
+  size_type upper_index(const K& k) const {
+    const key_type* keys = this->key_data();
+    return (std::upper_bound(keys, keys + this->size(), k, this->_comp) -
+            keys);
+  }
+
+  // i가 lower_index(k)일 때, 그 자리의 key가 k와 같은지.
+  template < typename K >
+  bool is_key_at(size_type i, const K& k) const {
+    return (i != this->size() && !this->_comp(k, _keys[i]));
+  }
+
+  // k가 있으면 그 index, 없으면 size().
+  template < typename K >
+  size_type find_index(const K& k) const {
+    size_type i = this->lower_index(k);
+    return (this->is_key_at(i, k) ? i : this->size());
+  }
+
+  /**
+   * position 바로 앞이 k가 들어갈 자리면 position의 index를 리턴한다.
+   * (앞 key < k <= position의 key) 아니면 binary search로 찾는다.
+   */
+  size_type hint_index(iterator position, const key_type& k) const {
+    size_type i = position.key_base() - this->key_data();
+
+    if ((i == 0 || this->_comp(_keys[i - 1], k)) &&
+        (i == this->size() || !this->_comp(_keys[i], k))) {
+      return (i);
+    }
+    return (this->lower_index(k));
+  }
+
+  // i 자리에 (k, v)를 넣는다. value 쪽에서 예외가 나면 key도 되돌린다.
+  void insert_at(size_type i, const key_type& k, const mapped_type& v) {
+    _keys.insert(_keys.begin() + i, k);
+    try {
+      _values.insert(_values.begin() + i, v);
+    } catch (...) {
+      _keys.erase(_keys.begin() + i);
+      throw;
+    }
+  }
+
+  template < class M >
+  pair< iterator, bool > insert_unique(const key_type& k, const M& obj) {
+    size_type i = this->lower_index(k);
+
+    if (this->is_key_at(i, k)) {
+      return (ft::make_pair(this->iterator_at(i), false));
+    }
+    this->insert_at(i, k, mapped_type(obj));
+    return (ft::make_pair(this->iterator_at(i), true));
+  }
+
+  template < class M >
+  iterator insert_hint(iterator position, const key_type& k, const M& obj) {
+    size_type i = this->hint_index(position, k);
+
+    if (!this->is_key_at(i, k)) {
+      this->insert_at(i, k, mapped_type(obj));
+    }
+    return (this->iterator_at(i));
+  }
+
+  /**
+   * key 순서로 정렬된 [first, last)를 넣는다. Key가 같으면 기존 element,
+   * 그 다음은 [first, last)에서 앞에 있는 것이 남는다.
+   * 모두 기존 key보다 크면 뒤에 붙이고, 아니면 새 배열에 한 번에 merge 한
+   * 뒤 바꾼다. 어느 쪽이든 예외가 나면 insert 전 그대로다.
+   */
+  void merge_sorted(const entry_type* first, const entry_type* last) {
+    if (this->empty() || this->_comp(_keys.back(), first->first)) {
+      this->append_sorted(first, last);
+      return;
+    }
+
+    key_vector keys(_keys.get_allocator());
+    mapped_vector values(_values.get_allocator());
+    size_type n = this->size();
+    size_type i = 0;
+
+    keys.reserve(n + (last - first));
+    values.reserve(n + (last - first));
+    while (first != last) {
+      for (; i < n && this->_comp(_keys[i], first->first); ++i) {
+        keys.push_back(_keys[i]);
+        values.push_back(_values[i]);
+      }
+      if (i == n || this->_comp(first->first, _keys[i])) {
+        keys.push_back(first->first);
+        values.push_back(first->second);
+      }
+      first = this->skip_equal(first, last);
+    }
+    for (; i < n; ++i) {
+      keys.push_back(_keys[i]);
+      values.push_back(_values[i]);
+    }
+    _keys.swap(keys);
+    _values.swap(values);
+  }
+
+  void append_sorted(const entry_type* first, const entry_type* last) {
+    size_type n = this->size();
+
+    this->reserve(n + (last - first));
+    try {
+      while (first != last) {
+        _keys.push_back(first->first);
+        _values.push_back(first->second);
+        first = this->skip_equal(first, last);
+      }
+    } catch (...) {
+      _keys.erase(_keys.begin() + n, _keys.end());
+      _values.erase(_values.begin() + n, _values.end());
+      throw;
+    }
+  }
+
+  // first와 Key가 같은 element를 건너뛴 다음 위치.
+  const entry_type* skip_equal(const entry_type* first,
+                               const entry_type* last) const {
+    const entry_type* next = first + 1;
+
+    while (next != last && !this->_comp(first->first, next->first)) {
+      ++next;
+    }
+    return (next);
+  }
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator==(const flat_map< Key, T, Compare, Alloc >& lhs,
+                const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return (lhs.size() == rhs.size() &&
+          ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator!=(const flat_map< Key, T, Compare, Alloc >& lhs,
+                const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return (!(lhs == rhs));
+}
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator<(const flat_map< Key, T, Compare, Alloc >& lhs,
+               const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                      rhs.end()));
+}
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator<=(const flat_map< Key, T, Compare, Alloc >& lhs,
+                const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return (!(rhs < lhs));
+}
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator>(const flat_map< Key, T, Compare, Alloc >& lhs,
+               const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return (rhs < lhs);
+}
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator>=(const flat_map< Key, T, Compare, Alloc >& lhs,
+                const flat_map< Key, T, Compare, Alloc >& rhs) {
+  return (!(lhs < rhs));
+}
+
+template < class Key, class T, class Compare, class Alloc >
+void swap(flat_map< Key, T, Compare, Alloc >& x,
+          flat_map< Key, T, Compare, Alloc >& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif  // FLAT_MAP_HPP
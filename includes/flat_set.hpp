@@ -0,0 +1,403 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_set.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(FLAT_SET_HPP)
+#define FLAT_SET_HPP
+
+#include <algorithm>
+#include <memory>
+
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft {
+/**
+ * 정렬된 ft::vector 하나에 담는 set. (flat_map 참고)
+ * 인터페이스는 ft::set과 같고, 탐색은 binary search다.
+ * element를 바꾸면 정렬이 깨지므로 iterator도 const_iterator와 같다.
+ * insert / erase 후에는 모든 iterator가 무효가 된다.
+ */
+template < class T, class Compare = ft::less< T >,
+           class Alloc = std::allocator< T > >
+class flat_set {
+ public:
+  typedef T key_type;
+  typedef T value_type;
+  typedef Compare key_compare;
+  typedef Compare value_compare;
+  typedef Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+
+ private:
+  typedef ft::vector< value_type, allocator_type > key_vector;
+
+ public:
+  typedef typename key_vector::const_iterator iterator;
+  typedef typename key_vector::const_iterator const_iterator;
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  typedef typename key_vector::difference_type difference_type;
+  typedef size_t size_type;
+
+ private:
+  key_vector _keys;
+  key_compare _comp;
+  allocator_type _alloc;
+
+  // transparent comparator인 경우에만 K로 탐색하는 함수를 허용한다.
+  template < typename K, typename R >
+  struct if_transparent
+      : ft::enable_if< ft::is_transparent< Compare, K >::value, R > {};
+
+ public:
+  explicit flat_set(const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type())
+      : _keys(alloc), _comp(comp), _alloc(alloc) {}
+
+  template < class InputIterator >
+  flat_set(InputIterator first, InputIterator last,
+           const key_compare& comp = key_compare(),
+           const allocator_type& alloc = allocator_type(),
+           typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                   InputIterator >::type* = u_nullptr)
+      : _keys(alloc), _comp(comp), _alloc(alloc) {
+    insert(first, last);
+  }
+
+  flat_set(const flat_set& x)
+      : _keys(x._keys), _comp(x._comp), _alloc(x._alloc) {}
+
+  virtual ~flat_set() {}
+
+  flat_set& operator=(const flat_set& x) {
+    if (this != &x) {
+      flat_set tmp(x);
+      this->swap(tmp);
+    }
+    return (*this);
+  }
+
+#if __cplusplus >= 201103L
+  // 빈 배열을 만든 뒤 x와 바꾼다. x는 빈 flat_set으로 남는다.
+  flat_set(flat_set&& x) : _keys(x._alloc), _comp(x._comp), _alloc(x._alloc) {
+    this->swap(x);
+  }
+
+  flat_set& operator=(flat_set&& x) {
+    if (this != &x) {
+      this->clear();
+      this->swap(x);
+    }
+    return (*this);
+  }
+#endif
+
+  const_iterator begin() const { return (_keys.begin()); }
+  const_iterator end() const { return (_keys.end()); }
+  const_reverse_iterator rbegin() const {
+    return (const_reverse_iterator(this->end()));
+  }
+  const_reverse_iterator rend() const {
+    return (const_reverse_iterator(this->begin()));
+  }
+
+  bool empty() const { return (_keys.empty()); }
+  size_type size() const { return (_keys.size()); }
+  size_type max_size() const { return (_keys.max_size()); }
+
+  void reserve(size_type n) { _keys.reserve(n); }
+  size_type capacity() const { return (_keys.capacity()); }
+  void shrink_to_fit() { _keys.shrink_to_fit(); }
+
+  /**
+   * insert 성공시
+   * pair(새로운 element를 가리키는 iterator, true) 리턴.
+   * insert 실패시
+   * pair(val과 동일한 Key값 갖고있는 iterator, false) 리턴.
+   */
+  pair< iterator, bool > insert(const value_type& val) {
+    size_type i = this->lower_index(val);
+
+    if (this->is_key_at(i, val)) {
+      return (ft::make_pair(this->iterator_at(i), false));
+    }
+    _keys.insert(_keys.begin() + i, val);
+    return (ft::make_pair(this->iterator_at(i), true));
+  }
+
+  /**
+   * position은 hint, 강제 아님.
+   * hint가 맞으면 binary search 없이 그 자리에 넣는다.
+   */
+  iterator insert(iterator position, const value_type& val) {
+    size_type i = this->hint_index(position, val);
+
+    if (!this->is_key_at(i, val)) {
+      _keys.insert(_keys.begin() + i, val);
+    }
+    return (this->iterator_at(i));
+  }
+
+#if __cplusplus >= 201103L
+  // args로 value를 만들어 insert 한다. 같은 값이 있으면 만든 것은 버린다.
+  template < class... Args >
+  pair< iterator, bool > emplace(Args&&... args) {
+    return (insert(value_type(std::forward< Args >(args)...)));
+  }
+
+  template < class... Args >
+  iterator emplace_hint(iterator position, Args&&... args) {
+    return (insert(position, value_type(std::forward< Args >(args)...)));
+  }
+#endif
+
+  /**
+   * [first, last) 구간의 element를 insert. 중복되는 element는 추가 X.
+   * 따로 모아서 한 번 정렬한 뒤 기존 배열과 한 번에 merge 한다.
+   * O(n + m log m) (flat_map::insert(first, last)와 같음)
+   */
+  template < class InputIterator >
+  void insert(InputIterator first, InputIterator last,
+              typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                      InputIterator >::type* = u_nullptr) {
+    key_vector entries(first, last, this->_alloc);
+
+    if (entries.empty()) return;
+
+    value_type* sorted = entries.begin().base();
+    std::stable_sort(sorted, sorted + entries.size(), this->_comp);
+    this->merge_sorted(sorted, sorted + entries.size());
+  }
+
+  void erase(iterator position) {
+    _keys.erase(_keys.begin() + (position - this->begin()));
+  }
+
+  // erase 성공 시 1, 실패 시 0 리턴.
+  size_type erase(const key_type& k) {
+    size_type i = this->lower_index(k);
+
+    if (!this->is_key_at(i, k)) return (0);
+    _keys.erase(_keys.begin() + i);
+    return (1);
+  }
+
+  void erase(iterator first, iterator last) {
+    _keys.erase(_keys.begin() + (first - this->begin()),
+                _keys.begin() + (last - this->begin()));
+  }
+
+  void swap(flat_set& x) {
+    _keys.swap(x._keys);
+    std::swap(this->_comp, x._comp);
+    std::swap(this->_alloc, x._alloc);
+  }
+
+  void clear() { _keys.clear(); }
+
+  key_compare key_comp() const { return (this->_comp); }
+  value_compare value_comp() const { return (this->_comp); }
+
+  const_iterator find(const key_type& k) const {
+    return (this->iterator_at(this->find_index(k)));
+  }
+
+  // set은 Key가 unique하기떄문에, 1 또는 0이다.
+  size_type count(const key_type& k) const {
+    return (this->find_index(k) != this->size());
+  }
+
+  const_iterator lower_bound(const key_type& k) const {
+    return (this->iterator_at(this->lower_index(k)));
+  }
+  const_iterator upper_bound(const key_type& k) const {
+    return (this->iterator_at(this->upper_index(k)));
+  }
+
+  pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+  }
+
+  /**
+   * transparent comparator(Compare::is_transparent)인 경우,
+   * x를 key_type으로 바꾸지 않고 그대로 탐색한다.
+   */
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type find(const K& x) const {
+    return (this->iterator_at(this->find_index(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, size_type >::type count(const K& x) const {
+    return (this->find_index(x) != this->size());
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type lower_bound(
+      const K& x) const {
+    return (this->iterator_at(this->lower_index(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type upper_bound(
+      const K& x) const {
+    return (this->iterator_at(this->upper_index(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, pair< const_iterator, const_iterator > >::type
+  equal_range(const K& x) const {
+    return (ft::make_pair(this->iterator_at(this->lower_index(x)),
+                          this->iterator_at(this->upper_index(x))));
+  }
+
+  allocator_type get_allocator() const { return (this->_alloc); }
+
+ private:
+  const value_type* key_data() const { return (_keys.begin().base()); }
+
+  const_iterator iterator_at(size_type i) const {
+    return (const_iterator(this->key_data() + i));
+  }
+
+  template < typename K >
+  size_type lower_index(const K& k) const {
+    const value_type* keys = this->key_data();
+    return (std::lower_bound(keys, keys + this->size(), k, this->_comp) -
+            keys);
+  }
+
+  template < typename K >
+  size_type upper_index(const K& k) const {
+    const value_type* keys = this->key_data();
+    return (std::upper_bound(keys, keys + this->size(), k, this->_comp) -
+            keys);
+  }
+
+  // i가 lower_index(k)일 때, 그 자리의 key가 k와 같은지.
+  template < typename K >
+  bool is_key_at(size_type i, const K& k) const {
+    return (i != this->size() && !this->_comp(k, _keys[i]));
+  }
+
+  template < typename K >
+  size_type find_index(const K& k) const {
+    size_type i = this->lower_index(k);
+    return (this->is_key_at(i, k) ? i : this->size());
+  }
+
+  // position 바로 앞이 k가 들어갈 자리면 position의 index를 리턴한다.
+  size_type hint_index(iterator position, const value_type& k) const {
+    size_type i = position - this->begin();
+
+    if ((i == 0 || this->_comp(_keys[i - 1], k)) &&
+        (i == this->size() || !this->_comp(_keys[i], k))) {
+      return (i);
+    }
+    return (this->lower_index(k));
+  }
+
+  /**
+   * 정렬된 [first, last)를 넣는다. 같은 값이면 기존 element가 남는다.
+   * 모두 기존 값보다 크면 뒤에 붙이고, 아니면 새 배열에 merge 한 뒤 바꾼다.
+   */
+  void merge_sorted(const value_type* first, const value_type* last) {
+    size_type n = this->size();
+
+    if (n == 0 || this->_comp(_keys.back(), *first)) {
+      this->reserve(n + (last - first));
+      try {
+        for (; first != last; first = this->skip_equal(first, last)) {
+          _keys.push_back(*first);
+        }
+      } catch (...) {
+        _keys.erase(_keys.begin() + n, _keys.end());
+        throw;
+      }
+      return;
+    }
+
+    key_vector keys(this->_alloc);
+    size_type i = 0;
+
+    keys.reserve(n + (last - first));
+    for (; first != last; first = this->skip_equal(first, last)) {
+      for (; i < n && this->_comp(_keys[i], *first); ++i) {
+        keys.push_back(_keys[i]);
+      }
+      if (i == n || this->_comp(*first, _keys[i])) {
+        keys.push_back(*first);
+      }
+    }
+    for (; i < n; ++i) {
+      keys.push_back(_keys[i]);
+    }
+    _keys.swap(keys);
+  }
+
+  // first와 같은 값을 건너뛴 다음 위치.
+  const value_type* skip_equal(const value_type* first,
+                               const value_type* last) const {
+    const value_type* next = first + 1;
+
+    while (next != last && !this->_comp(*first, *next)) {
+      ++next;
+    }
+    return (next);
+  }
+};
+
+template < class T, class Compare, class Alloc >
+bool operator==(const flat_set< T, Compare, Alloc >& lhs,
+                const flat_set< T, Compare, Alloc >& rhs) {
+  return (lhs.size() == rhs.size() &&
+          ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template < class T, class Compare, class Alloc >
+bool operator!=(const flat_set< T, Compare, Alloc >& lhs,
+                const flat_set< T, Compare, Alloc >& rhs) {
+  return (!(lhs == rhs));
+}
+
+template < class T, class Compare, class Alloc >
+bool operator<(const flat_set< T, Compare, Alloc >& lhs,
+               const flat_set< T, Compare, Alloc >& rhs) {
+  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                      rhs.end()));
+}
+
+template < class T, class Compare, class Alloc >
+bool operator<=(const flat_set< T, Compare, Alloc >& lhs,
+                const flat_set< T, Compare, Alloc >& rhs) {
+  return (!(rhs < lhs));
+}
+
+template < class T, class Compare, class Alloc >
+bool operator>(const flat_set< T, Compare, Alloc >& lhs,
+               const flat_set< T, Compare, Alloc >& rhs) {
+  return (rhs < lhs);
+}
+
+template < class T, class Compare, class Alloc >
+bool operator>=(const flat_set< T, Compare, Alloc >& lhs,
+                const flat_set< T, Compare, Alloc >& rhs) {
+  return (!(lhs < rhs));
+}
+
+template < class T, class Compare, class Alloc >
+void swap(flat_set< T, Compare, Alloc >& x, flat_set< T, Compare, Alloc >& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif  // FLAT_SET_HPP
@@ -0,0 +1,265 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen_map.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(FROZEN_MAP_HPP)
+#define FROZEN_MAP_HPP
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include "eytzinger.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft {
+/**
+ * 만든 뒤에는 바꿀 수 없는 map. (map::freeze()의 결과)
+ * key와 value를 flat_map처럼 따로 된 배열에 두되, 정렬 순서가 아니라
+ * Eytzinger(BFS) 순서로 둔다. find / lower_bound는 분기 없이 내려가며
+ * 몇 단계 아래를 prefetch 하므로, tree의 노드를 따라가는 것보다 cache
+ * miss가 훨씬 적다. (eytzinger 참고)
+ * iterator는 key 순서로 돌지만 한 칸마다 index 계산이 있어서 vector보다
+ * 느리다. 탐색이 주 용도다.
+ */
+template < class Key, class T, class Compare = ft::less< Key >,
+           class Alloc = std::allocator< ft::pair< const Key, T > > >
+class frozen_map {
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef ft::pair< const key_type, mapped_type > value_type;
+  typedef Compare key_compare;
+  typedef Alloc allocator_type;
+  typedef ft::FrozenMapIterator< key_type, mapped_type > const_iterator;
+  typedef const_iterator iterator;
+  typedef typename const_iterator::reference reference;
+  typedef typename const_iterator::reference const_reference;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  typedef const_reverse_iterator reverse_iterator;
+  typedef ptrdiff_t difference_type;
+  typedef size_t size_type;
+
+ private:
+  typedef typename Alloc::template rebind< key_type >::other key_alloc_type;
+  typedef typename Alloc::template rebind< mapped_type >::other
+      mapped_alloc_type;
+  typedef ft::vector< key_type, key_alloc_type > key_vector;
+  typedef ft::vector< mapped_type, mapped_alloc_type > mapped_vector;
+
+  // 만들 때 key 순서로 잠깐 모아두는 element.
+  typedef ft::pair< key_type, mapped_type > entry_type;
+  typedef typename Alloc::template rebind< entry_type >::other
+      entry_alloc_type;
+  typedef ft::vector< entry_type, entry_alloc_type > entry_vector;
+
+  struct entry_compare {
+    Compare comp;
+    entry_compare(const Compare& c) : comp(c) {}
+    bool operator()(const entry_type& x, const entry_type& y) const {
+      return (comp(x.first, y.first));
+    }
+  };
+
+  key_vector _keys;
+  mapped_vector _values;
+  key_compare _comp;
+  allocator_type _alloc;
+
+  // transparent comparator인 경우에만 K로 탐색하는 함수를 허용한다.
+  template < typename K, typename R >
+  struct if_transparent
+      : ft::enable_if< ft::is_transparent< Compare, K >::value, R > {};
+
+ public:
+  explicit frozen_map(const key_compare& comp = key_compare(),
+                      const allocator_type& alloc = allocator_type())
+      : _keys(key_alloc_type(alloc)),
+        _values(mapped_alloc_type(alloc)),
+        _comp(comp),
+        _alloc(alloc) {}
+
+  /**
+   * [first, last)로 만든다. Key가 같으면 앞에 나온 element가 남는다.
+   * 이미 key 순서인 구간(map의 begin, end)이면 정렬하지 않는다.
+   */
+  template < class InputIterator >
+  frozen_map(InputIterator first, InputIterator last,
+             const key_compare& comp = key_compare(),
+             const allocator_type& alloc = allocator_type(),
+             typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                     InputIterator >::type* = u_nullptr)
+      : _keys(key_alloc_type(alloc)),
+        _values(mapped_alloc_type(alloc)),
+        _comp(comp),
+        _alloc(alloc) {
+    entry_vector entries(entry_alloc_type(this->_alloc));
+
+    for (; first != last; ++first) {
+      entries.push_back(entry_type((*first).first, (*first).second));
+    }
+    this->build(entries);
+  }
+
+  frozen_map(const frozen_map& x)
+      : _keys(x._keys), _values(x._values), _comp(x._comp), _alloc(x._alloc) {}
+
+  virtual ~frozen_map() {}
+
+  frozen_map& operator=(const frozen_map& x) {
+    if (this != &x) {
+      frozen_map tmp(x);
+      this->swap(tmp);
+    }
+    return (*this);
+  }
+
+  const_iterator begin() const {
+    return (this->iterator_at(eytzinger::first(this->size())));
+  }
+  const_iterator end() const { return (this->iterator_at(0)); }
+  const_reverse_iterator rbegin() const {
+    return (const_reverse_iterator(this->end()));
+  }
+  const_reverse_iterator rend() const {
+    return (const_reverse_iterator(this->begin()));
+  }
+
+  bool empty() const { return (_keys.empty()); }
+  size_type size() const { return (_keys.size()); }
+  size_type max_size() const {
+    return (std::min(_keys.max_size(), _values.max_size()));
+  }
+
+  // k가 없으면 std::out_of_range.
+  const mapped_type& at(const key_type& k) const {
+    size_type i = this->find_index(k);
+
+    if (i == 0) throw(std::out_of_range("ft::frozen_map::at"));
+    return (_values[i - 1]);
+  }
+
+  void swap(frozen_map& x) {
+    _keys.swap(x._keys);
+    _values.swap(x._values);
+    std::swap(this->_comp, x._comp);
+    std::swap(this->_alloc, x._alloc);
+  }
+
+  key_compare key_comp() const { return (this->_comp); }
+
+  const_iterator find(const key_type& k) const {
+    return (this->iterator_at(this->find_index(k)));
+  }
+  size_type count(const key_type& k) const {
+    return (this->find_index(k) != 0);
+  }
+  const_iterator lower_bound(const key_type& k) const {
+    return (this->iterator_at(eytzinger::lower_bound(
+        this->key_data(), this->size(), k, this->_comp)));
+  }
+  const_iterator upper_bound(const key_type& k) const {
+    return (this->iterator_at(eytzinger::upper_bound(
+        this->key_data(), this->size(), k, this->_comp)));
+  }
+  pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+  }
+
+  /**
+   * transparent comparator(Compare::is_transparent)인 경우,
+   * x를 key_type으로 바꾸지 않고 그대로 탐색한다.
+   */
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type find(const K& x) const {
+    return (this->iterator_at(this->find_index(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, size_type >::type count(const K& x) const {
+    return (this->find_index(x) != 0);
+  }
+
+  allocator_type get_allocator() const { return (this->_alloc); }
+
+ private:
+  const key_type* key_data() const { return (_keys.begin().base()); }
+
+  const_iterator iterator_at(size_type i) const {
+    return (const_iterator(this->key_data(), _values.begin().base(), i,
+                           this->size()));
+  }
+
+  template < typename K >
+  size_type find_index(const K& k) const {
+    return (eytzinger::find(this->key_data(), this->size(), k, this->_comp));
+  }
+
+  /**
+   * entries를 key 순서로 정렬하고 중복을 지운 뒤 Eytzinger 순서로 옮긴다.
+   * 이미 정렬되어 있고 중복이 없으면 확인만 한다. (O(n))
+   */
+  void build(entry_vector& entries) {
+    entry_type* data = entries.begin().base();
+    size_type n = entries.size();
+    size_type unique = 1;
+
+    if (n == 0) return;
+    if (!this->is_sorted_unique(data, n)) {
+      std::stable_sort(data, data + n, entry_compare(this->_comp));
+      for (size_type i = 1; i < n; ++i) {
+        if (this->_comp(data[unique - 1].first, data[i].first)) {
+          data[unique++] = data[i];
+        }
+      }
+      n = unique;
+    }
+
+    ft::vector< size_t > rank_of;
+    eytzinger::ranks(rank_of, n);
+    _keys.reserve(n);
+    _values.reserve(n);
+    for (size_type i = 0; i < n; ++i) {
+      _keys.push_back(data[rank_of[i]].first);
+      _values.push_back(data[rank_of[i]].second);
+    }
+  }
+
+  bool is_sorted_unique(const entry_type* data, size_type n) const {
+    for (size_type i = 1; i < n; ++i) {
+      if (!this->_comp(data[i - 1].first, data[i].first)) return (false);
+    }
+    return (true);
+  }
+};
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator==(const frozen_map< Key, T, Compare, Alloc >& lhs,
+                const frozen_map< Key, T, Compare, Alloc >& rhs) {
+  return (lhs.size() == rhs.size() &&
+          ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template < class Key, class T, class Compare, class Alloc >
+bool operator!=(const frozen_map< Key, T, Compare, Alloc >& lhs,
+                const frozen_map< Key, T, Compare, Alloc >& rhs) {
+  return (!(lhs == rhs));
+}
+
+template < class Key, class T, class Compare, class Alloc >
+void swap(frozen_map< Key, T, Compare, Alloc >& x,
+          frozen_map< Key, T, Compare, Alloc >& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif  // FROZEN_MAP_HPP
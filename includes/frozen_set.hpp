@@ -0,0 +1,215 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   frozen_set.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(FROZEN_SET_HPP)
+#define FROZEN_SET_HPP
+
+#include <algorithm>
+#include <memory>
+
+#include "eytzinger.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft {
+/**
+ * 만든 뒤에는 바꿀 수 없는 set. (set::freeze()의 결과)
+ * key를 Eytzinger 순서의 배열 하나에 둔다. (frozen_map 참고)
+ */
+template < class T, class Compare = ft::less< T >,
+           class Alloc = std::allocator< T > >
+class frozen_set {
+ public:
+  typedef T key_type;
+  typedef T value_type;
+  typedef Compare key_compare;
+  typedef Compare value_compare;
+  typedef Alloc allocator_type;
+  typedef typename allocator_type::const_reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef ft::FrozenSetIterator< value_type > const_iterator;
+  typedef const_iterator iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  typedef const_reverse_iterator reverse_iterator;
+  typedef ptrdiff_t difference_type;
+  typedef size_t size_type;
+
+ private:
+  typedef ft::vector< value_type, allocator_type > key_vector;
+
+  key_vector _keys;
+  key_compare _comp;
+  allocator_type _alloc;
+
+  // transparent comparator인 경우에만 K로 탐색하는 함수를 허용한다.
+  template < typename K, typename R >
+  struct if_transparent
+      : ft::enable_if< ft::is_transparent< Compare, K >::value, R > {};
+
+ public:
+  explicit frozen_set(const key_compare& comp = key_compare(),
+                      const allocator_type& alloc = allocator_type())
+      : _keys(alloc), _comp(comp), _alloc(alloc) {}
+
+  /**
+   * [first, last)로 만든다. 같은 값은 하나만 남는다.
+   * 이미 정렬된 구간(set의 begin, end)이면 정렬하지 않는다.
+   */
+  template < class InputIterator >
+  frozen_set(InputIterator first, InputIterator last,
+             const key_compare& comp = key_compare(),
+             const allocator_type& alloc = allocator_type(),
+             typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                     InputIterator >::type* = u_nullptr)
+      : _keys(alloc), _comp(comp), _alloc(alloc) {
+    key_vector entries(first, last, alloc);
+
+    this->build(entries);
+  }
+
+  frozen_set(const frozen_set& x)
+      : _keys(x._keys), _comp(x._comp), _alloc(x._alloc) {}
+
+  virtual ~frozen_set() {}
+
+  frozen_set& operator=(const frozen_set& x) {
+    if (this != &x) {
+      frozen_set tmp(x);
+      this->swap(tmp);
+    }
+    return (*this);
+  }
+
+  const_iterator begin() const {
+    return (this->iterator_at(eytzinger::first(this->size())));
+  }
+  const_iterator end() const { return (this->iterator_at(0)); }
+  const_reverse_iterator rbegin() const {
+    return (const_reverse_iterator(this->end()));
+  }
+  const_reverse_iterator rend() const {
+    return (const_reverse_iterator(this->begin()));
+  }
+
+  bool empty() const { return (_keys.empty()); }
+  size_type size() const { return (_keys.size()); }
+  size_type max_size() const { return (_keys.max_size()); }
+
+  void swap(frozen_set& x) {
+    _keys.swap(x._keys);
+    std::swap(this->_comp, x._comp);
+    std::swap(this->_alloc, x._alloc);
+  }
+
+  key_compare key_comp() const { return (this->_comp); }
+  value_compare value_comp() const { return (this->_comp); }
+
+  const_iterator find(const key_type& k) const {
+    return (this->iterator_at(this->find_index(k)));
+  }
+  size_type count(const key_type& k) const {
+    return (this->find_index(k) != 0);
+  }
+  const_iterator lower_bound(const key_type& k) const {
+    return (this->iterator_at(eytzinger::lower_bound(
+        this->key_data(), this->size(), k, this->_comp)));
+  }
+  const_iterator upper_bound(const key_type& k) const {
+    return (this->iterator_at(eytzinger::upper_bound(
+        this->key_data(), this->size(), k, this->_comp)));
+  }
+  pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+  }
+
+  /**
+   * transparent comparator(Compare::is_transparent)인 경우,
+   * x를 key_type으로 바꾸지 않고 그대로 탐색한다.
+   */
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type find(const K& x) const {
+    return (this->iterator_at(this->find_index(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, size_type >::type count(const K& x) const {
+    return (this->find_index(x) != 0);
+  }
+
+  allocator_type get_allocator() const { return (this->_alloc); }
+
+ private:
+  const value_type* key_data() const { return (_keys.begin().base()); }
+
+  const_iterator iterator_at(size_type i) const {
+    return (const_iterator(this->key_data(), i, this->size()));
+  }
+
+  template < typename K >
+  size_type find_index(const K& k) const {
+    return (eytzinger::find(this->key_data(), this->size(), k, this->_comp));
+  }
+
+  // entries를 정렬하고 중복을 지운 뒤 Eytzinger 순서로 옮긴다.
+  void build(key_vector& entries) {
+    value_type* data = entries.begin().base();
+    size_type n = entries.size();
+    size_type unique = 1;
+
+    if (n == 0) return;
+    if (!this->is_sorted_unique(data, n)) {
+      std::stable_sort(data, data + n, this->_comp);
+      for (size_type i = 1; i < n; ++i) {
+        if (this->_comp(data[unique - 1], data[i])) {
+          data[unique++] = data[i];
+        }
+      }
+      n = unique;
+    }
+
+    ft::vector< size_t > rank_of;
+    eytzinger::ranks(rank_of, n);
+    _keys.reserve(n);
+    for (size_type i = 0; i < n; ++i) {
+      _keys.push_back(data[rank_of[i]]);
+    }
+  }
+
+  bool is_sorted_unique(const value_type* data, size_type n) const {
+    for (size_type i = 1; i < n; ++i) {
+      if (!this->_comp(data[i - 1], data[i])) return (false);
+    }
+    return (true);
+  }
+};
+
+template < class T, class Compare, class Alloc >
+bool operator==(const frozen_set< T, Compare, Alloc >& lhs,
+                const frozen_set< T, Compare, Alloc >& rhs) {
+  return (lhs.size() == rhs.size() &&
+          ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template < class T, class Compare, class Alloc >
+bool operator!=(const frozen_set< T, Compare, Alloc >& lhs,
+                const frozen_set< T, Compare, Alloc >& rhs) {
+  return (!(lhs == rhs));
+}
+
+template < class T, class Compare, class Alloc >
+void swap(frozen_set< T, Compare, Alloc >& x,
+          frozen_set< T, Compare, Alloc >& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif  // FROZEN_SET_HPP
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   growth_policy.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(GROWTH_POLICY_HPP)
+#define GROWTH_POLICY_HPP
+
+#include <cstddef>
+
+namespace ft {
+
+/**
+ * vector의 capacity를 늘리는 규칙.
+ * next_capacity는 지금 capacity와 최소로 필요한 크기(required)를 받아
+ * 새로 잡을 capacity를 리턴한다. (required 이상, max 이하)
+ * elem_size는 element 하나의 byte 크기.
+ */
+
+// 2배씩. (기본값)
+struct growth_double {
+  static size_t next_capacity(size_t capacity, size_t required, size_t,
+                              size_t max) {
+    size_t len = (capacity > max / 2) ? max : capacity * 2;
+
+    return (len < required ? required : len);
+  }
+};
+
+// 1.5배씩. 2배보다 reallocation은 잦지만 남는 메모리가 적다.
+struct growth_golden {
+  static size_t next_capacity(size_t capacity, size_t required, size_t,
+                              size_t max) {
+    size_t len =
+        (capacity > max - capacity / 2) ? max : capacity + capacity / 2;
+
+    return (len < required ? required : len);
+  }
+};
+
+/**
+ * Threshold byte보다 작을 때는 2배, 큰 buffer는 1.5배씩 늘리고 byte 크기를
+ * PageSize의 배수로 맞춘다.
+ * (큰 할당은 어차피 page 단위로 잡히므로 그 끝까지 capacity로 쓴다)
+ */
+template < size_t PageSize = 4096, size_t Threshold = 1024 * 1024 >
+struct growth_page_aligned {
+  static size_t next_capacity(size_t capacity, size_t required,
+                              size_t elem_size, size_t max) {
+    size_t len;
+
+    if (capacity * elem_size < Threshold) {
+      len = growth_double::next_capacity(capacity, required, elem_size, max);
+    } else {
+      len = growth_golden::next_capacity(capacity, required, elem_size, max);
+    }
+    if (len * elem_size < PageSize || max - len < PageSize) {
+      return (len);
+    }
+    size_t bytes = (len * elem_size + PageSize - 1) / PageSize * PageSize;
+    return (bytes / elem_size);
+  }
+};
+
+}  // namespace ft
+
+#endif  // GROWTH_POLICY_HPP
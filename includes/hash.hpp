@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(HASH_HPP)
+#define HASH_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace ft {
+/**
+ * unordered_map, unordered_set의 기본 hash.
+ * 정수와 포인터는 값을 그대로 리턴하고, 섞는 일은 HashTable이
+ * hash_mix로 한다. (연속된 정수 key도 bucket에 고르게 퍼진다)
+ * 정의되지 않은 type은 compile error.
+ */
+template < class T >
+struct hash;
+
+// size_t 크기에 맞는 상수. (FNV-1a, Fibonacci hashing)
+template < size_t Bytes >
+struct hash_constants {
+  static const size_t fnv_offset = 2166136261UL;
+  static const size_t fnv_prime = 16777619UL;
+  static const size_t golden = 0x9E3779B9UL;
+};
+
+template <>
+struct hash_constants< 8 > {
+  static const size_t fnv_offset =
+      (static_cast< size_t >(0xCBF29CE4UL) << 32) | 0x84222325UL;
+  static const size_t fnv_prime =
+      (static_cast< size_t >(0x100UL) << 32) | 0x1B3UL;
+  static const size_t golden =
+      (static_cast< size_t >(0x9E3779B9UL) << 32) | 0x7F4A7C15UL;
+};
+
+typedef hash_constants< sizeof(size_t) > hash_const;
+
+// 메모리의 byte를 FNV-1a로 hash 한다. (문자열, 실수)
+inline size_t hash_bytes(const void* data, size_t len) {
+  const unsigned char* p = static_cast< const unsigned char* >(data);
+  size_t h = hash_const::fnv_offset;
+
+  for (size_t i = 0; i < len; ++i) {
+    h ^= p[i];
+    h *= hash_const::fnv_prime;
+  }
+  return (h);
+}
+
+/**
+ * Fibonacci hashing. 곱하면 정보가 위쪽 bit로 모이므로 위쪽 절반을 아래쪽에
+ * 다시 섞는다. HashTable은 아래쪽 bit로 bucket을 고른다.
+ */
+inline size_t hash_mix(size_t h) {
+  h *= hash_const::golden;
+  return (h ^ (h >> (sizeof(size_t) * 4)));
+}
+
+template < class T >
+struct integral_hash {
+  typedef T argument_type;
+  typedef size_t result_type;
+
+  size_t operator()(T x) const { return (static_cast< size_t >(x)); }
+};
+
+template <>
+struct hash< bool > : integral_hash< bool > {};
+template <>
+struct hash< char > : integral_hash< char > {};
+template <>
+struct hash< signed char > : integral_hash< signed char > {};
+template <>
+struct hash< unsigned char > : integral_hash< unsigned char > {};
+template <>
+struct hash< wchar_t > : integral_hash< wchar_t > {};
+template <>
+struct hash< short > : integral_hash< short > {};
+template <>
+struct hash< unsigned short > : integral_hash< unsigned short > {};
+template <>
+struct hash< int > : integral_hash< int > {};
+template <>
+struct hash< unsigned int > : integral_hash< unsigned int > {};
+template <>
+struct hash< long > : integral_hash< long > {};
+template <>
+struct hash< unsigned long > : integral_hash< unsigned long > {};
+
+template < class T >
+struct hash< T* > {
+  typedef T* argument_type;
+  typedef size_t result_type;
+
+  size_t operator()(T* p) const { return (reinterpret_cast< size_t >(p)); }
+};
+
+// 0.0과 -0.0은 같은 값이므로 같은 hash.
+template < class T >
+struct floating_hash {
+  typedef T argument_type;
+  typedef size_t result_type;
+
+  size_t operator()(T x) const {
+    return (x == 0 ? 0 : ft::hash_bytes(&x, sizeof(x)));
+  }
+};
+
+template <>
+struct hash< float > : floating_hash< float > {};
+template <>
+struct hash< double > : floating_hash< double > {};
+
+template <>
+struct hash< std::string > {
+  typedef std::string argument_type;
+  typedef size_t result_type;
+
+  size_t operator()(const std::string& s) const {
+    return (ft::hash_bytes(s.data(), s.size()));
+  }
+};
+
+}  // namespace ft
+
+#endif  // HASH_HPP
@@ -14,6 +14,7 @@
 #define ITERATOR_TRAITS_HPP
 
 #include <cstddef>
+#include <iterator>
 
 namespace ft {
 
@@ -28,6 +29,40 @@ struct bidirectional_iterator_tag : public forward_iterator_tag {};
 struct random_access_iterator_tag : public bidirectional_iterator_tag {};
 
 
+/**
+ * iterator category를 ft의 tag로 맞춘다.
+ * std container의 iterator는 std의 tag를 쓰므로 ft의 tag로 바꿔준다.
+ */
+template < class Category >
+struct iterator_category_traits {
+  typedef Category iterator_category;
+};
+
+template <>
+struct iterator_category_traits< std::input_iterator_tag > {
+  typedef input_iterator_tag iterator_category;
+};
+
+template <>
+struct iterator_category_traits< std::output_iterator_tag > {
+  typedef output_iterator_tag iterator_category;
+};
+
+template <>
+struct iterator_category_traits< std::forward_iterator_tag > {
+  typedef forward_iterator_tag iterator_category;
+};
+
+template <>
+struct iterator_category_traits< std::bidirectional_iterator_tag > {
+  typedef bidirectional_iterator_tag iterator_category;
+};
+
+template <>
+struct iterator_category_traits< std::random_access_iterator_tag > {
+  typedef random_access_iterator_tag iterator_category;
+};
+
 /**
  * iterator 특성들의 type이름을 고정.
  * Iterator의 성격이 달라도 통일해서 사용할 수 있다.
@@ -59,6 +94,18 @@ struct iterator_traits< const T* > {
   typedef random_access_iterator_tag iterator_category;
 };
 
+/**
+ * tag dispatch용. Iterator의 category tag를 ft의 tag로 만들어 리턴한다.
+ */
+template < class Iterator >
+typename iterator_category_traits<
+    typename iterator_traits< Iterator >::iterator_category >::iterator_category
+iterator_category(const Iterator&) {
+  typedef typename iterator_traits< Iterator >::iterator_category tag;
+  typedef typename iterator_category_traits< tag >::iterator_category category;
+  return (category());
+}
+
 template < class Category, class T, class Distance = ptrdiff_t,
            class Pointer = T*, class Reference = T& >
 struct iterator {
@@ -69,6 +116,21 @@ struct iterator {
   typedef Category iterator_category;
 };
 
+/**
+ * iterator가 가리키는 element의 pointer. (reverse_iterator::operator-> 용)
+ * reference가 진짜 reference가 아닌 proxy인 iterator(flat_map)도 있으므로
+ * &(*it) 대신 it의 operator->를 그대로 쓴다.
+ */
+template < class T >
+T* to_pointer(T* p) {
+  return (p);
+}
+
+template < class Iterator >
+typename Iterator::pointer to_pointer(const Iterator& it) {
+  return (it.operator->());
+}
+
 template < class Iterator >
 class reverse_iterator {
  public:
@@ -90,8 +152,8 @@ class reverse_iterator {
   reverse_iterator(const reverse_iterator< Iter >& rev_it)
       : current(rev_it.base()) {}
 
-  /* Destructor added to follow subject. */
-  // virtual ~reverse_iterator() {}
+  // 감싼 iterator가 trivially copyable이면 reverse_iterator도 그렇게 두기
+  // 위해 소멸자를 선언하지 않는다.
 
   iterator_type base() const { return (current); }
 
@@ -140,7 +202,10 @@ class reverse_iterator {
     return (*this);
   }
 
-  pointer operator->() const { return (&(operator*())); }
+  pointer operator->() const {
+    iterator_type tmp = current;
+    return (ft::to_pointer(--tmp));
+  }
 
   reference operator[](difference_type n) const {
     return (this->current[-n - 1]);
@@ -14,10 +14,18 @@
 #define MAP_HPP
 
 #include "RB_Tree.hpp"
+#include "frozen_map.hpp"
 
 namespace ft {
+/**
+ * Ranked가 true면 tree가 sub-tree 크기를 유지해서 nth(k), rank(key)와
+ * iterator 사이의 ft::distance가 O(log n)이다. (RB_Tree 참고)
+ *   ft::map< K, V, ft::less< K >, std::allocator< ft::pair< const K, V > >,
+ *            true >
+ */
 template < class Key, class T, class Compare = ft::less< Key >,
-           class Alloc = std::allocator< ft::pair< const Key, T > > >
+           class Alloc = std::allocator< ft::pair< const Key, T > >,
+           bool Ranked = false >
 class map {
  public:
   typedef Key key_type;
@@ -26,6 +34,8 @@ class map {
   typedef Compare key_compare;
 
   class value_compare : ft::binary_function< value_type, value_type, bool > {
+    friend class map;
+
    protected:
     Compare comp;
     value_compare(Compare c) : comp(c) {}
@@ -38,6 +48,16 @@ class map {
     bool operator()(const value_type& x, const value_type& y) const {
       return comp(x.first, y.first);
     }
+
+    // tree에서 key만으로 탐색할 때 쓰인다. (value_type을 만들지 않음)
+    template < typename K >
+    bool operator()(const K& x, const value_type& y) const {
+      return comp(x, y.first);
+    }
+    template < typename K >
+    bool operator()(const value_type& x, const K& y) const {
+      return comp(x.first, y);
+    }
   };
 
   typedef Alloc allocator_type;
@@ -46,28 +66,35 @@ class map {
   typedef typename allocator_type::pointer pointer;
   typedef typename allocator_type::const_pointer const_pointer;
 
-  typedef ft::RB_TreeIterator< value_type, value_type*, value_type& > iterator;
+  typedef ft::RB_TreeIterator< value_type, value_type*, value_type&, Ranked >
+      iterator;
   typedef ft::RB_TreeIterator< value_type, const value_type*,
-                               const value_type& >
+                               const value_type&, Ranked >
       const_iterator;
   typedef ft::reverse_iterator< iterator > reverse_iterator;
   typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
   typedef
       typename ft::iterator_traits< iterator >::difference_type difference_type;
   typedef size_t size_type;
-  typedef
-      typename ft::RB_Tree< value_type, value_compare >::node_type node_type;
-  typedef ft::RB_Tree< value_type, value_compare > tree_type;
+  typedef ft::RB_Tree< value_type, value_compare, allocator_type, Ranked >
+      tree_type;
+  typedef typename tree_type::node_type node_type;
+  typedef ft::frozen_map< Key, T, Compare, Alloc > frozen_type;
 
  private:
   tree_type _tree;
   key_compare _comp;
   allocator_type _alloc;
 
+  // transparent comparator인 경우에만 K로 탐색하는 함수를 허용한다.
+  template < typename K, typename R >
+  struct if_transparent
+      : ft::enable_if< ft::is_transparent< Compare, K >::value, R > {};
+
  public:
   explicit map(const key_compare& comp = key_compare(),
                const allocator_type& alloc = allocator_type())
-      : _tree(), _comp(comp), _alloc(alloc) {}
+      : _tree(value_compare(comp), alloc), _comp(comp), _alloc(alloc) {}
 
   template < class InputIterator >
   map(InputIterator first, InputIterator last,
@@ -75,21 +102,38 @@ class map {
       const allocator_type& alloc = allocator_type(),
       typename ft::enable_if< !ft::is_integral< InputIterator >::value,
                               InputIterator >::type* = u_nullptr)
-      : _tree(), _comp(comp), _alloc(alloc) {
+      : _tree(value_compare(comp), alloc), _comp(comp), _alloc(alloc) {
     insert(first, last);
   }
 
-  map(const map& x) : _tree(), _comp(x._comp), _alloc(x._alloc) { *this = x; }
+  map(const map& x) : _tree(x._tree), _comp(x._comp), _alloc(x._alloc) {}
 
   virtual ~map() {}
 
   map& operator=(const map& x) {
     if (this != &x) {
-      this->_tree.copy(x._tree);
+      this->_comp = x._comp;
+      this->_tree = x._tree;
     }
     return (*this);
   }
 
+#if __cplusplus >= 201103L
+  // x의 tree를 그대로 가져온다. (할당하지 않음) x는 빈 map이 된다.
+  map(map&& x) noexcept
+      : _tree(std::move(x._tree)), _comp(x._comp), _alloc(x._alloc) {}
+
+  // 지금 tree는 tmp와 같이 사라진다. x의 노드는 x의 node allocator로
+  // 반환해야 하므로 swap으로 allocator까지 같이 가져온다.
+  map& operator=(map&& x) noexcept {
+    if (this != &x) {
+      map tmp(std::move(x));
+      this->swap(tmp);
+    }
+    return (*this);
+  }
+#endif
+
   iterator begin() { return (iterator(_tree.get_front_node())); }
   const_iterator begin() const {
     return (const_iterator(_tree.get_front_node()));
@@ -108,19 +152,96 @@ class map {
 
   bool empty() const { return (_tree.is_empty_tree()); }
   size_type size() const { return (_tree.size()); }
-  size_type max_size() const {
-    typename tree_type::node_alloc_type _node_alloc;
-    return (_node_alloc.max_size());
-  }
+  size_type max_size() const { return (_tree.max_size()); }
 
-  /* tree에서 k 키를 갖는 노드 만든다고 가정하고 들어감. (insert 사용.)
-  어차피 있으면 해당 이터레이터 리턴할것임. */
+  // k가 없을 때만 mapped_type()으로 노드를 만든다.
+  // (있으면 할당도, mapped_type 생성도 없음)
   mapped_type& operator[](const key_type& k) {
+    return (try_emplace(k).first->second);
+  }
+
+#if __cplusplus >= 201103L
+  mapped_type& operator[](key_type&& k) {
+    return (try_emplace(std::move(k)).first->second);
+  }
+
+  /**
+   * k가 없으면 (k, mapped_type(args...))를 insert 한다.
+   * k가 이미 있으면 아무것도 만들지 않고 그 element를 리턴한다.
+   * 리턴값은 insert(val)과 같다.
+   */
+  template < class... Args >
+  pair< iterator, bool > try_emplace(const key_type& k, Args&&... args) {
+    return (try_emplace_at(k, NULL, std::forward< Args >(args)...));
+  }
+
+  template < class... Args >
+  pair< iterator, bool > try_emplace(key_type&& k, Args&&... args) {
+    return (
+        try_emplace_at(std::move(k), NULL, std::forward< Args >(args)...));
+  }
+
+  // position은 hint, 강제 아님.
+  template < class... Args >
+  iterator try_emplace(iterator position, const key_type& k, Args&&... args) {
+    return (try_emplace_at(k, position.base(), std::forward< Args >(args)...)
+                .first);
+  }
+
+  template < class... Args >
+  iterator try_emplace(iterator position, key_type&& k, Args&&... args) {
+    return (try_emplace_at(std::move(k), position.base(),
+                           std::forward< Args >(args)...)
+                .first);
+  }
+
+  /**
+   * args로 value_type을 만들어 insert 한다. key를 알려면 먼저 만들어야
+   * 하므로 같은 key가 있으면 만든 노드를 버린다. (key를 안다면 try_emplace)
+   */
+  template < class... Args >
+  pair< iterator, bool > emplace(Args&&... args) {
     ft::pair< node_type*, bool > result =
-        _tree.insert(value_type(k, mapped_type()));
-    return ((result.first)->value->second);
+        _tree.emplace(NULL, std::forward< Args >(args)...);
+    return (ft::make_pair(iterator(result.first), result.second));
+  }
+
+  template < class... Args >
+  iterator emplace_hint(iterator position, Args&&... args) {
+    return (iterator(
+        _tree.emplace(position.base(), std::forward< Args >(args)...).first));
   }
 
+  pair< iterator, bool > insert(value_type&& val) {
+    ft::pair< node_type*, bool > result = _tree.insert(std::move(val));
+    return (ft::make_pair(iterator(result.first), result.second));
+  }
+#else
+  /**
+   * k가 없으면 (k, mapped_type(obj))를 insert 한다.
+   * k가 이미 있으면 아무것도 만들지 않고 그 element를 리턴한다.
+   * 리턴값은 insert(val)과 같다.
+   */
+  pair< iterator, bool > try_emplace(const key_type& k) {
+    return (try_emplace_at(k, NULL));
+  }
+
+  template < class M >
+  pair< iterator, bool > try_emplace(const key_type& k, const M& obj) {
+    return (try_emplace_at(k, NULL, obj));
+  }
+
+  // position은 hint, 강제 아님.
+  iterator try_emplace(iterator position, const key_type& k) {
+    return (try_emplace_at(k, position.base()).first);
+  }
+
+  template < class M >
+  iterator try_emplace(iterator position, const key_type& k, const M& obj) {
+    return (try_emplace_at(k, position.base(), obj).first);
+  }
+#endif
+
   /**
    * insert 성공시
    * pair(새로운 element를 가리키는 iterator, true) 리턴.
@@ -153,10 +274,7 @@ class map {
   void insert(InputIterator first, InputIterator last,
               typename ft::enable_if< !ft::is_integral< InputIterator >::value,
                                       InputIterator >::type* = u_nullptr) {
-    while (first != last) {
-      _tree.insert(*first);
-      first++;
-    }
+    _tree.insert_range(first, last);
   }
 
   void erase(iterator position) { _tree.erase(position.base()); }
@@ -167,7 +285,7 @@ class map {
    * nil노드 erase실행시 실패.
    */
   size_type erase(const key_type& k) {
-    return (_tree.erase(_tree.search(value_type(k, mapped_type()))));
+    return (_tree.erase(_tree.search(k)));
   }
 
   void erase(iterator first, iterator last) {
@@ -177,105 +295,209 @@ class map {
   }
 
   void swap(map& x) {
-    if (*this == x) {
-      return;
-    }
-
-    unsigned char buf[sizeof(map)];
-    memcpy(buf, reinterpret_cast< void* >(&x), sizeof(map));
-    memcpy(reinterpret_cast< unsigned char* >(&x),
-           reinterpret_cast< void* >(this), sizeof(map));
-    memcpy(reinterpret_cast< unsigned char* >(this),
-           reinterpret_cast< void* >(buf), sizeof(map));
+    _tree.swap(x._tree);
+    std::swap(this->_comp, x._comp);
+    std::swap(this->_alloc, x._alloc);
   }
 
   void clear() { _tree.clear(); }
 
-  key_compare key_comp() const { return (key_compare()); }
-  value_compare value_comp() const { return (value_compare()); }
+  key_compare key_comp() const { return (this->_comp); }
+  value_compare value_comp() const { return (value_compare(this->_comp)); }
 
-  iterator find(const key_type& k) {
-    return (iterator(_tree.search(value_type(k, mapped_type()))));
-  }
+  iterator find(const key_type& k) { return (iterator(_tree.search(k))); }
 
   const_iterator find(const key_type& k) const {
-    return (const_iterator(_tree.search(value_type(k, mapped_type()))));
+    return (const_iterator(_tree.search(k)));
   }
 
   /* k Key 있으면 1, 없으면 0.
   map은 Key가 unique하기떄문에, 1 또는 0이다. */
-  size_type count(const key_type& k) const {
-    if (_tree.search(value_type(k, mapped_type()))->is_nil()) {
-      return 0;
-    }
-    return 1;
-  }
+  size_type count(const key_type& k) const { return (_tree.count(k)); }
 
   iterator lower_bound(const key_type& k) {
-    return (iterator(_tree.lower_bound(value_type(k, mapped_type()))));
+    return (iterator(_tree.lower_bound(k)));
   }
   const_iterator lower_bound(const key_type& k) const {
-    return (const_iterator(_tree.lower_bound(value_type(k, mapped_type()))));
+    return (const_iterator(_tree.lower_bound(k)));
   }
   iterator upper_bound(const key_type& k) {
-    return (iterator(_tree.upper_bound(value_type(k, mapped_type()))));
+    return (iterator(_tree.upper_bound(k)));
   }
   const_iterator upper_bound(const key_type& k) const {
-    return (const_iterator(_tree.upper_bound(value_type(k, mapped_type()))));
+    return (const_iterator(_tree.upper_bound(k)));
   }
 
   pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
-    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+    ft::pair< node_type*, node_type* > range = _tree.equal_range(k);
+    return (ft::make_pair(const_iterator(range.first),
+                          const_iterator(range.second)));
   }
   pair< iterator, iterator > equal_range(const key_type& k) {
-    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+    ft::pair< node_type*, node_type* > range = _tree.equal_range(k);
+    return (ft::make_pair(iterator(range.first), iterator(range.second)));
+  }
+
+  /**
+   * transparent comparator(Compare::is_transparent)인 경우,
+   * x를 key_type으로 바꾸지 않고 그대로 탐색한다.
+   */
+  template < typename K >
+  typename if_transparent< K, iterator >::type find(const K& x) {
+    return (iterator(_tree.search(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type find(const K& x) const {
+    return (const_iterator(_tree.search(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, size_type >::type count(const K& x) const {
+    return (_tree.count(x));
+  }
+  template < typename K >
+  typename if_transparent< K, iterator >::type lower_bound(const K& x) {
+    return (iterator(_tree.lower_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type lower_bound(
+      const K& x) const {
+    return (const_iterator(_tree.lower_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, iterator >::type upper_bound(const K& x) {
+    return (iterator(_tree.upper_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type upper_bound(
+      const K& x) const {
+    return (const_iterator(_tree.upper_bound(x)));
   }
+  template < typename K >
+  typename if_transparent< K, pair< iterator, iterator > >::type equal_range(
+      const K& x) {
+    ft::pair< node_type*, node_type* > range = _tree.equal_range(x);
+    return (ft::make_pair(iterator(range.first), iterator(range.second)));
+  }
+  template < typename K >
+  typename if_transparent< K, pair< const_iterator, const_iterator > >::type
+  equal_range(const K& x) const {
+    ft::pair< node_type*, node_type* > range = _tree.equal_range(x);
+    return (ft::make_pair(const_iterator(range.first),
+                          const_iterator(range.second)));
+  }
+
+  /**
+   * key 순서로 k번째(0부터) element. k >= size()면 end().
+   * rank(key)는 key보다 작은 key의 수. (lower_bound(key)의 위치)
+   * 둘 다 Ranked인 map에서만 쓸 수 있다. O(log n)
+   */
+  iterator nth(size_type k) { return (iterator(_tree.select(k))); }
+  const_iterator nth(size_type k) const {
+    return (const_iterator(_tree.select(k)));
+  }
+  size_type rank(const key_type& k) const { return (_tree.rank(k)); }
+
+  allocator_type get_allocator() const { return (this->_alloc); }
 
-  allocator_type get_allocator() const { return (allocator_type()); }
+  /**
+   * 지금 내용을 복사한 읽기 전용 map. 이후 이 map을 바꿔도 그대로다.
+   * 탐색만 많이 할 거라면 tree보다 cache miss가 적다. (frozen_map 참고)
+   */
+  frozen_type freeze() const {
+    return (frozen_type(this->begin(), this->end(), this->_comp, this->_alloc));
+  }
 
   void showTree() { _tree.showMap(); }
+
+ private:
+  // k의 자리를 먼저 찾고, 없을 때만 value_type을 만들어 그 자리에 단다.
+#if __cplusplus >= 201103L
+  template < class K, class... Args >
+  pair< iterator, bool > try_emplace_at(K&& k, node_type* hint,
+                                        Args&&... args) {
+    bool left;
+    ft::pair< node_type*, bool > position =
+        _tree.find_insert_position(k, hint, left);
+
+    if (!position.second) {
+      return (ft::make_pair(iterator(position.first), false));
+    }
+    node_type* inserted =
+        _tree.emplace_at(position.first, left, std::forward< K >(k),
+                         mapped_type(std::forward< Args >(args)...));
+    return (ft::make_pair(iterator(inserted), true));
+  }
+#else
+  template < class M >
+  pair< iterator, bool > try_emplace_at(const key_type& k, node_type* hint,
+                                        const M& obj) {
+    bool left;
+    ft::pair< node_type*, bool > position =
+        _tree.find_insert_position(k, hint, left);
+
+    if (!position.second) {
+      return (ft::make_pair(iterator(position.first), false));
+    }
+    node_type* inserted = _tree.emplace_at(position.first, left, k, obj);
+    return (ft::make_pair(iterator(inserted), true));
+  }
+
+  // k가 없을 때만 노드 안에서 mapped_type()을 만든다. (operator[]도 이것)
+  pair< iterator, bool > try_emplace_at(const key_type& k, node_type* hint) {
+    bool left;
+    ft::pair< node_type*, bool > position =
+        _tree.find_insert_position(k, hint, left);
+
+    if (!position.second) {
+      return (ft::make_pair(iterator(position.first), false));
+    }
+    node_type* inserted = _tree.emplace_key_at(position.first, left, k);
+    return (ft::make_pair(iterator(inserted), true));
+  }
+#endif
 };
 
-template < class Key, class T, class Compare, class Alloc >
-bool operator==(const map< Key, T, Compare, Alloc >& lhs,
-                const map< Key, T, Compare, Alloc >& rhs) {
+template < class Key, class T, class Compare, class Alloc, bool R >
+bool operator==(const map< Key, T, Compare, Alloc, R >& lhs,
+                const map< Key, T, Compare, Alloc, R >& rhs) {
   return (lhs.size() == rhs.size() &&
           ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
 }
 
-template < class Key, class T, class Compare, class Alloc >
-bool operator!=(const map< Key, T, Compare, Alloc >& lhs,
-                const map< Key, T, Compare, Alloc >& rhs) {
+template < class Key, class T, class Compare, class Alloc, bool R >
+bool operator!=(const map< Key, T, Compare, Alloc, R >& lhs,
+                const map< Key, T, Compare, Alloc, R >& rhs) {
   return (!(lhs == rhs));
 }
 
-template < class Key, class T, class Compare, class Alloc >
-bool operator<(const map< Key, T, Compare, Alloc >& lhs,
-               const map< Key, T, Compare, Alloc >& rhs) {
+template < class Key, class T, class Compare, class Alloc, bool R >
+bool operator<(const map< Key, T, Compare, Alloc, R >& lhs,
+               const map< Key, T, Compare, Alloc, R >& rhs) {
   return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
                                       rhs.end()));
 }
 
-template < class Key, class T, class Compare, class Alloc >
-bool operator<=(const map< Key, T, Compare, Alloc >& lhs,
-                const map< Key, T, Compare, Alloc >& rhs) {
+template < class Key, class T, class Compare, class Alloc, bool R >
+bool operator<=(const map< Key, T, Compare, Alloc, R >& lhs,
+                const map< Key, T, Compare, Alloc, R >& rhs) {
   return (!(rhs < lhs));
 }
 
-template < class Key, class T, class Compare, class Alloc >
-bool operator>(const map< Key, T, Compare, Alloc >& lhs,
-               const map< Key, T, Compare, Alloc >& rhs) {
+template < class Key, class T, class Compare, class Alloc, bool R >
+bool operator>(const map< Key, T, Compare, Alloc, R >& lhs,
+               const map< Key, T, Compare, Alloc, R >& rhs) {
   return (rhs < lhs);
 }
 
-template < class Key, class T, class Compare, class Alloc >
-bool operator>=(const map< Key, T, Compare, Alloc >& lhs,
-                const map< Key, T, Compare, Alloc >& rhs) {
+template < class Key, class T, class Compare, class Alloc, bool R >
+bool operator>=(const map< Key, T, Compare, Alloc, R >& lhs,
+                const map< Key, T, Compare, Alloc, R >& rhs) {
   return (!(lhs < rhs));
 }
 
-template < class Key, class T, class Compare, class Alloc >
-void swap(map< Key, T, Compare, Alloc >& x, map< Key, T, Compare, Alloc >& y) {
+template < class Key, class T, class Compare, class Alloc, bool R >
+void swap(map< Key, T, Compare, Alloc, R >& x,
+          map< Key, T, Compare, Alloc, R >& y) {
   x.swap(y);
 }
 
@@ -0,0 +1,297 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pool_allocator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(POOL_ALLOCATOR_HPP)
+#define POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
+namespace ft {
+
+/**
+ * RB_Tree 노드처럼 크기가 고정된 객체를 위한 slab allocator.
+ * chunk 단위로 메모리를 받아 앞에서부터 하나씩 나눠주고,
+ * deallocate된 자리는 free list에 넣어두었다가 다시 나눠준다.
+ * chunk는 16개 자리부터 시작해 MaxChunk개까지 두 배씩 커진다.
+ *
+ * 복사한 allocator끼리는 같은 pool을 공유하고 (reference count),
+ * rebind로 다른 type에서 만든 allocator는 새 pool을 갖는다.
+ * 그래서 map< K, V, C, ft::pool_allocator< ... > > 는 tree마다 자기 pool을
+ * 따로 갖게 된다. (RB_Tree는 release()로 자기 노드를 한 번에 반환하므로
+ * 다른 tree와 pool을 공유하면 안 된다)
+ *
+ * 노드 전용 allocator다. 표준 allocator 요구사항과 달리 A(B(a)) == a 가
+ * 아니고, 기본 생성이나 rebind를 할 때마다 pool을 새로 할당한다.
+ * rebind 하거나 새로 만든 allocator로 다른 allocator의 메모리를 반환하는
+ * container에는 쓸 수 없다. vector에 쓰면 크기 1인 buffer만 pool에서
+ * 받으므로 얻는 것이 없다.
+ *
+ * release()는 chunk 전체를 한 번에 반환한다. (O(chunk 갯수))
+ * 이 pool에서 받은 객체는 release() 전에 모두 destroy 되어 있어야 한다.
+ *
+ * allocate(n)에서 n != 1 인 경우는 pool을 거치지 않고 operator new를 쓴다.
+ */
+template < typename T, size_t MaxChunk = 1024 >
+class pool_allocator {
+ public:
+  typedef T value_type;
+  typedef T* pointer;
+  typedef const T* const_pointer;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+  template < typename U >
+  struct rebind {
+    typedef pool_allocator< U, MaxChunk > other;
+  };
+
+ private:
+  // T의 alignment. (T를 construct 하지 않고 크기만 본다)
+  struct align_helper {
+    char c;
+    T t;
+  };
+
+  // 빈 자리는 free list의 다음 자리를 가리키는 데 쓴다.
+  struct slot {
+    slot* next;
+  };
+
+  struct chunk {
+    chunk* next;
+  };
+
+  static size_type round_up(size_type n, size_type align) {
+    return ((n + align - 1) / align * align);
+  }
+
+  static size_type slot_size() {
+    size_type align = sizeof(align_helper) - sizeof(T);
+
+    if (align < sizeof(slot*)) {
+      align = sizeof(slot*);
+    }
+    return (round_up(sizeof(T) > sizeof(slot) ? sizeof(T) : sizeof(slot),
+                     align));
+  }
+
+  // chunk 맨 앞의 header 뒤에서부터 자리를 나눠준다.
+  static size_type header_size() {
+    return (round_up(sizeof(chunk), slot_size()));
+  }
+
+  struct pool {
+    chunk* chunks;
+    slot* free_list;
+    char* cursor;
+    char* end;
+    size_type next_chunk;
+    size_type refs;
+  };
+
+  pool* _pool;
+
+  template < typename U, size_t N >
+  friend class pool_allocator;
+
+  static pool* new_pool() {
+    pool* p = new pool;
+
+    p->chunks = NULL;
+    p->free_list = NULL;
+    p->cursor = NULL;
+    p->end = NULL;
+    p->next_chunk = MaxChunk < 16 ? MaxChunk : 16;
+    p->refs = 1;
+    return (p);
+  }
+
+  void unref() {
+    if (--this->_pool->refs == 0) {
+      release();
+      delete this->_pool;
+    }
+  }
+
+  void add_chunk() {
+    size_type slots = this->_pool->next_chunk;
+    char* mem = static_cast< char* >(
+        ::operator new(header_size() + slots * slot_size()));
+    chunk* c = reinterpret_cast< chunk* >(mem);
+
+    c->next = this->_pool->chunks;
+    this->_pool->chunks = c;
+    this->_pool->cursor = mem + header_size();
+    this->_pool->end = this->_pool->cursor + slots * slot_size();
+    if (this->_pool->next_chunk < MaxChunk) {
+      this->_pool->next_chunk *= 2;
+      if (this->_pool->next_chunk > MaxChunk) {
+        this->_pool->next_chunk = MaxChunk;
+      }
+    }
+  }
+
+ public:
+  pool_allocator() : _pool(new_pool()) {}
+
+  pool_allocator(const pool_allocator& other) : _pool(other._pool) {
+    ++this->_pool->refs;
+  }
+
+  // 다른 type의 pool은 자리 크기가 다르므로 공유하지 않는다.
+  // 그래서 rebind 해서 다시 돌아온 allocator는 원래 allocator와 다르다.
+  template < typename U >
+  pool_allocator(const pool_allocator< U, MaxChunk >&) : _pool(new_pool()) {}
+
+  ~pool_allocator() { unref(); }
+
+  pool_allocator& operator=(const pool_allocator& other) {
+    if (this->_pool != other._pool) {
+      ++other._pool->refs;
+      unref();
+      this->_pool = other._pool;
+    }
+    return (*this);
+  }
+
+  pointer address(reference x) const { return (&x); }
+  const_pointer address(const_reference x) const { return (&x); }
+
+  pointer allocate(size_type n, const void* = 0) {
+    if (n != 1) {
+      return (static_cast< pointer >(::operator new(n * sizeof(T))));
+    }
+    if (this->_pool->free_list != NULL) {
+      slot* s = this->_pool->free_list;
+
+      this->_pool->free_list = s->next;
+      return (reinterpret_cast< pointer >(s));
+    }
+    if (this->_pool->cursor == this->_pool->end) {
+      add_chunk();
+    }
+    pointer p = reinterpret_cast< pointer >(this->_pool->cursor);
+    this->_pool->cursor += slot_size();
+    return (p);
+  }
+
+  void deallocate(pointer p, size_type n) {
+    if (n != 1) {
+      ::operator delete(p);
+      return;
+    }
+    slot* s = reinterpret_cast< slot* >(p);
+
+    s->next = this->_pool->free_list;
+    this->_pool->free_list = s;
+  }
+
+  // pool에서 나눠준 메모리를 chunk 단위로 한 번에 반환한다.
+  void release() {
+    chunk* c = this->_pool->chunks;
+
+    while (c != NULL) {
+      chunk* next = c->next;
+      ::operator delete(c);
+      c = next;
+    }
+    this->_pool->chunks = NULL;
+    this->_pool->free_list = NULL;
+    this->_pool->cursor = NULL;
+    this->_pool->end = NULL;
+    this->_pool->next_chunk = MaxChunk < 16 ? MaxChunk : 16;
+  }
+
+  size_type max_size() const {
+    return (std::numeric_limits< size_type >::max() / sizeof(T));
+  }
+
+#if __cplusplus >= 201103L
+  template < typename U, typename... Args >
+  void construct(U* p, Args&&... args) {
+    new (p) U(std::forward< Args >(args)...);
+  }
+#else
+  void construct(pointer p, const_reference val) { new (p) T(val); }
+#endif
+  void destroy(pointer p) { p->~T(); }
+
+  template < typename U, size_t N >
+  bool operator==(const pool_allocator< U, N >& other) const {
+    return (static_cast< const void* >(this->_pool) ==
+            static_cast< const void* >(other._pool));
+  }
+
+  template < typename U, size_t N >
+  bool operator!=(const pool_allocator< U, N >& other) const {
+    return (!(*this == other));
+  }
+};
+
+/**
+ * Alloc이 pool_allocator인지 체크한다.
+ * RB_Tree는 pool_allocator인 경우 노드를 하나씩 반환하지 않고
+ * release()로 한 번에 반환한다.
+ */
+template < typename Alloc >
+struct is_pool_allocator {
+  static const bool value = false;
+};
+
+template < typename T, size_t MaxChunk >
+struct is_pool_allocator< pool_allocator< T, MaxChunk > > {
+  static const bool value = true;
+};
+
+template < typename Alloc >
+void release_pool(Alloc&) {}
+
+template < typename T, size_t MaxChunk >
+void release_pool(pool_allocator< T, MaxChunk >& alloc) {
+  alloc.release();
+}
+
+/**
+ * release_pool()로 반환되면 안 되는 객체 하나를 할당한다.
+ * (RB_Tree의 nil처럼 clear() 후에도 주소가 그대로여야 하는 것)
+ * pool_allocator인 경우에는 pool을 거치지 않고 operator new를 쓴다.
+ */
+template < typename Alloc >
+typename Alloc::pointer allocate_outside_pool(Alloc& alloc) {
+  return (alloc.allocate(1));
+}
+
+template < typename T, size_t MaxChunk >
+T* allocate_outside_pool(pool_allocator< T, MaxChunk >&) {
+  return (static_cast< T* >(::operator new(sizeof(T))));
+}
+
+template < typename Alloc >
+void deallocate_outside_pool(Alloc& alloc, typename Alloc::pointer p) {
+  alloc.deallocate(p, 1);
+}
+
+template < typename T, size_t MaxChunk >
+void deallocate_outside_pool(pool_allocator< T, MaxChunk >&, T* p) {
+  ::operator delete(p);
+}
+
+}  // namespace ft
+
+#endif  // POOL_ALLOCATOR_HPP
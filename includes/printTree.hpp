@@ -21,8 +21,8 @@
 #define C_RESET "\e[0m"
 
 namespace ft {
-template < typename T >
-void printMap(RB_TreeNode< T >* node, int depth) {
+template < typename T, bool Ranked >
+void printMap(RB_TreeNode< T, Ranked >* node, int depth) {
   if (depth == 0) {
     std::cout << "// SHOW TREE //" << std::endl;
   }
@@ -39,7 +39,7 @@ void printMap(RB_TreeNode< T >* node, int depth) {
   }
   std::cout << (node->color ? C_RESET : C_RED)
             << (node->is_root() ? "Root" : (node->is_leftchild() ? "L" : "R"))
-            << " - key: " << node->value->first << C_RESET << std::endl;
+            << " - key: " << node->value.first << C_RESET << std::endl;
   if (!node->leftChild->is_nil()) {
     printMap(node->leftChild, depth + 1);
   }
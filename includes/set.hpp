@@ -14,6 +14,7 @@
 #define SET_HPP
 
 #include "RB_Tree.hpp"
+#include "frozen_set.hpp"
 #include "printTree.hpp"
 
 namespace ft {
@@ -40,19 +41,24 @@ class set {
   typedef
       typename ft::iterator_traits< iterator >::difference_type difference_type;
   typedef size_t size_type;
-  typedef
-      typename ft::RB_Tree< value_type, value_compare >::node_type node_type;
-  typedef ft::RB_Tree< value_type, value_compare > tree_type;
+  typedef ft::RB_Tree< value_type, value_compare, allocator_type > tree_type;
+  typedef typename tree_type::node_type node_type;
+  typedef ft::frozen_set< T, Compare, Alloc > frozen_type;
 
  private:
   tree_type _tree;
   key_compare _comp;
   allocator_type _alloc;
 
+  // transparent comparator인 경우에만 K로 탐색하는 함수를 허용한다.
+  template < typename K, typename R >
+  struct if_transparent
+      : ft::enable_if< ft::is_transparent< Compare, K >::value, R > {};
+
  public:
   explicit set(const key_compare& comp = key_compare(),
                const allocator_type& alloc = allocator_type())
-      : _tree(), _comp(comp), _alloc(alloc) {}
+      : _tree(comp, alloc), _comp(comp), _alloc(alloc) {}
 
   template < class InputIterator >
   set(InputIterator first, InputIterator last,
@@ -60,20 +66,37 @@ class set {
       const allocator_type& alloc = allocator_type(),
       typename ft::enable_if< !ft::is_integral< InputIterator >::value,
                               InputIterator >::type* = u_nullptr)
-      : _tree(), _comp(comp), _alloc(alloc) {
+      : _tree(comp, alloc), _comp(comp), _alloc(alloc) {
     insert(first, last);
   }
 
-  set(const set& x) : _tree(), _comp(x._comp), _alloc(x._alloc) { *this = x; }
+  set(const set& x) : _tree(x._tree), _comp(x._comp), _alloc(x._alloc) {}
 
   virtual ~set() {}
 
   set& operator=(const set& x) {
     if (this != &x) {
-      this->_tree.copy(x._tree);
+      this->_comp = x._comp;
+      this->_tree = x._tree;
+    }
+    return (*this);
+  }
+
+#if __cplusplus >= 201103L
+  // x의 tree를 그대로 가져온다. (할당하지 않음) x는 빈 set이 된다.
+  set(set&& x) noexcept
+      : _tree(std::move(x._tree)), _comp(x._comp), _alloc(x._alloc) {}
+
+  // 지금 tree는 tmp와 같이 사라진다. x의 노드는 x의 node allocator로
+  // 반환해야 하므로 swap으로 allocator까지 같이 가져온다.
+  set& operator=(set&& x) noexcept {
+    if (this != &x) {
+      set tmp(std::move(x));
+      this->swap(tmp);
     }
     return (*this);
   }
+#endif
 
   iterator begin() { return (iterator(_tree.get_front_node())); }
   const_iterator begin() const {
@@ -93,11 +116,7 @@ class set {
 
   bool empty() const { return (_tree.is_empty_tree()); }
   size_type size() const { return (_tree.size()); }
-  size_type max_size() const {
-    typename tree_type::node_alloc_type _node_alloc;
-    return (_node_alloc.max_size());
-    // return (_tree.max_size());
-  }
+  size_type max_size() const { return (_tree.max_size()); }
 
   /**
    * insert 성공시
@@ -122,6 +141,27 @@ class set {
     return (iterator(result.first));
   }
 
+#if __cplusplus >= 201103L
+  pair< iterator, bool > insert(value_type&& val) {
+    ft::pair< node_type*, bool > result = _tree.insert(std::move(val));
+    return (ft::make_pair(iterator(result.first), result.second));
+  }
+
+  // args로 value를 만들어 insert 한다. 같은 값이 있으면 만든 것은 버린다.
+  template < class... Args >
+  pair< iterator, bool > emplace(Args&&... args) {
+    ft::pair< node_type*, bool > result =
+        _tree.emplace(NULL, std::forward< Args >(args)...);
+    return (ft::make_pair(iterator(result.first), result.second));
+  }
+
+  template < class... Args >
+  iterator emplace_hint(iterator position, Args&&... args) {
+    return (iterator(
+        _tree.emplace(position.base(), std::forward< Args >(args)...).first));
+  }
+#endif
+
   /**
    * [first, last) 구간의 element를 insert.
    * 이때, 기존 Key와 중복되는 element는 추가 X.
@@ -131,16 +171,13 @@ class set {
   void insert(InputIterator first, InputIterator last,
               typename ft::enable_if< !ft::is_integral< InputIterator >::value,
                                       InputIterator >::type* = u_nullptr) {
-    while (first != last) {
-      _tree.insert(*first);
-      first++;
-    }
+    _tree.insert_range(first, last);
   }
 
   void erase(iterator position) { _tree.erase(position.base()); }
 
   size_type erase(const key_type& k) {
-    return (_tree.erase(_tree.search(value_type(k))));
+    return (_tree.erase(_tree.search(k)));
   }
 
   void erase(iterator first, iterator last) {
@@ -152,62 +189,103 @@ class set {
   }
 
   void swap(set& x) {
-    if (*this == x) {
-      return ;
-    }
-
-    unsigned char buf[sizeof(set)];
-    memcpy(buf, reinterpret_cast< void* >(&x), sizeof(set));
-    memcpy(reinterpret_cast< unsigned char* >(&x),
-           reinterpret_cast< void* >(this), sizeof(set));
-    memcpy(reinterpret_cast< unsigned char* >(this),
-           reinterpret_cast< void* >(buf), sizeof(set));
+    _tree.swap(x._tree);
+    std::swap(this->_comp, x._comp);
+    std::swap(this->_alloc, x._alloc);
   }
 
   void clear() { _tree.clear(); }
 
-  key_compare key_comp() const { return (key_compare()); }
-  value_compare value_comp() const { return (value_compare()); }
+  key_compare key_comp() const { return (this->_comp); }
+  value_compare value_comp() const { return (this->_comp); }
 
-  iterator find(const key_type& k) {
-    return (iterator(_tree.search(value_type(k))));
-  }
+  iterator find(const key_type& k) { return (iterator(_tree.search(k))); }
 
   const_iterator find(const key_type& k) const {
-    return (const_iterator(_tree.search(value_type(k))));
+    return (const_iterator(_tree.search(k)));
   }
 
   /* k Key 있으면 1, 없으면 0.
   map은 Key가 unique하기떄문에, 1 또는 0이다. */
-  size_type count(const key_type& k) const {
-    if (_tree.search(value_type(k))->is_nil()) {
-      return 0;
-    }
-    return 1;
-  }
+  size_type count(const key_type& k) const { return (_tree.count(k)); }
 
   iterator lower_bound(const key_type& k) {
-    return (iterator(_tree.lower_bound(value_type(k))));
+    return (iterator(_tree.lower_bound(k)));
   }
   const_iterator lower_bound(const key_type& k) const {
-    return (const_iterator(_tree.lower_bound(value_type(k))));
+    return (const_iterator(_tree.lower_bound(k)));
   }
   iterator upper_bound(const key_type& k) {
-    return (iterator(_tree.upper_bound(value_type(k))));
+    return (iterator(_tree.upper_bound(k)));
   }
   const_iterator upper_bound(const key_type& k) const {
-    return (const_iterator(_tree.upper_bound(value_type(k))));
+    return (const_iterator(_tree.upper_bound(k)));
   }
 
   pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
-    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+    ft::pair< node_type*, node_type* > range = _tree.equal_range(k);
+    return (ft::make_pair(const_iterator(range.first),
+                          const_iterator(range.second)));
   }
   pair< iterator, iterator > equal_range(const key_type& k) {
-    return (ft::make_pair(lower_bound(k), upper_bound(k)));
+    ft::pair< node_type*, node_type* > range = _tree.equal_range(k);
+    return (ft::make_pair(iterator(range.first), iterator(range.second)));
+  }
+
+  /**
+   * transparent comparator(Compare::is_transparent)인 경우,
+   * x를 key_type으로 바꾸지 않고 그대로 탐색한다.
+   */
+  template < typename K >
+  typename if_transparent< K, iterator >::type find(const K& x) {
+    return (iterator(_tree.search(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type find(const K& x) const {
+    return (const_iterator(_tree.search(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, size_type >::type count(const K& x) const {
+    return (_tree.count(x));
+  }
+  template < typename K >
+  typename if_transparent< K, iterator >::type lower_bound(const K& x) {
+    return (iterator(_tree.lower_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type lower_bound(
+      const K& x) const {
+    return (const_iterator(_tree.lower_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, iterator >::type upper_bound(const K& x) {
+    return (iterator(_tree.upper_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, const_iterator >::type upper_bound(
+      const K& x) const {
+    return (const_iterator(_tree.upper_bound(x)));
+  }
+  template < typename K >
+  typename if_transparent< K, pair< iterator, iterator > >::type equal_range(
+      const K& x) {
+    ft::pair< node_type*, node_type* > range = _tree.equal_range(x);
+    return (ft::make_pair(iterator(range.first), iterator(range.second)));
+  }
+  template < typename K >
+  typename if_transparent< K, pair< const_iterator, const_iterator > >::type
+  equal_range(const K& x) const {
+    ft::pair< node_type*, node_type* > range = _tree.equal_range(x);
+    return (ft::make_pair(const_iterator(range.first),
+                          const_iterator(range.second)));
   }
 
-  allocator_type get_allocator() const { return (allocator_type()); }
+  allocator_type get_allocator() const { return (this->_alloc); }
 
+  // 지금 내용을 복사한 읽기 전용 set. (frozen_set 참고)
+  frozen_type freeze() const {
+    return (frozen_type(this->begin(), this->end(), this->_comp, this->_alloc));
+  }
 };
 
 template < class T, class Compare, class Alloc >
@@ -0,0 +1,485 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+#include "VectorIterator.hpp"
+#include "growth_policy.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft {
+
+/**
+ * element N개까지는 객체 안의 buffer에 담고, 넘어가면 heap으로 옮기는
+ * vector. 인터페이스와 iterator는 ft::vector와 같고, element를 옮기는
+ * 코드(vector_ops, relocator)도 ft::vector와 같이 쓴다.
+ * N이 0이면 처음부터 heap을 쓴다.
+ * heap으로 옮긴 뒤에는 shrink_to_fit으로 size가 N 이하가 되어야 다시
+ * 안쪽 buffer로 돌아온다.
+ */
+template < typename T, size_t N, typename Allocator = std::allocator< T >,
+           typename Growth = ft::growth_double >
+class small_vector {
+ public:
+  typedef T value_type;
+  typedef Allocator allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+  typedef ft::VectorIterator< T > iterator;
+  typedef ft::VectorIterator< const T > const_iterator;
+  typedef ft::reverse_iterator< iterator > reverse_iterator;
+  typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
+  typedef typename allocator_type::size_type size_type;
+  typedef typename allocator_type::difference_type difference_type;
+  typedef Growth growth_policy;
+
+  static const size_type inline_capacity = N;
+
+ private:
+  typedef ft::relocator< ft::is_trivially_copyable< T >::value &&
+                         ft::is_default_allocator< Allocator, T >::value >
+      relocator;
+  typedef ft::destroyer< ft::is_trivially_destructible< T >::value &&
+                         ft::is_default_allocator< Allocator, T >::value >
+      destroyer;
+  typedef ft::vector_ops< relocator, destroyer > ops;
+
+  // T를 construct 하지 않은 N개 자리. (alignment를 위해 union으로 묶는다)
+  union inline_storage {
+    char bytes[sizeof(T) * (N ? N : 1)];
+    long double ld;
+    double d;
+    long l;
+    void *p;
+  };
+
+  allocator_type _alloc;
+  pointer _start;
+  pointer _end;
+  pointer _end_capacity;
+  inline_storage _buf;
+
+ public:
+  explicit small_vector(const allocator_type &alloc = allocator_type())
+      : _alloc(alloc) {
+    reset_inline();
+  }
+
+  explicit small_vector(size_type n, const value_type &val = value_type(),
+                        const allocator_type &alloc = allocator_type())
+      : _alloc(alloc) {
+    reset_inline();
+    this->assign(n, val);
+  }
+
+  template < typename InputIterator >
+  small_vector(InputIterator first, InputIterator last,
+               const allocator_type &alloc = allocator_type(),
+               typename ft::enable_if<
+                   !ft::is_integral< InputIterator >::value,
+                   InputIterator >::type * = u_nullptr)
+      : _alloc(alloc) {
+    reset_inline();
+    this->insert(this->end(), first, last);
+  }
+
+  small_vector(const small_vector &x) : _alloc(x._alloc) {
+    reset_inline();
+    this->assign(x._start, x._end);
+  }
+
+  ~small_vector() {
+    this->clear();
+    release();
+  }
+
+  small_vector &operator=(const small_vector &x) {
+    if (this != &x) {
+      this->assign(x._start, x._end);
+    }
+    return (*this);
+  }
+
+#if __cplusplus >= 201103L
+  // x가 heap에 있으면 buffer를 가져오고, 안쪽 buffer에 있으면 element를
+  // 하나씩 옮긴다. x는 빈 small_vector로 남는다.
+  small_vector(small_vector &&x) : _alloc(x._alloc) {
+    reset_inline();
+    take(x);
+  }
+
+  // heap buffer를 반환할 allocator도 같이 가져온다. (swap과 같다)
+  small_vector &operator=(small_vector &&x) {
+    if (this != &x) {
+      this->clear();
+      release();
+      this->_alloc = x._alloc;
+      take(x);
+    }
+    return (*this);
+  }
+#endif
+
+  iterator begin() { return (iterator(this->_start)); }
+  const_iterator begin() const { return (const_iterator(this->_start)); }
+  iterator end() { return (iterator(this->_end)); }
+  const_iterator end() const { return (const_iterator(this->_end)); }
+  reverse_iterator rbegin() { return (reverse_iterator(this->_end)); }
+  const_reverse_iterator rbegin() const {
+    return (const_reverse_iterator(this->_end));
+  }
+  reverse_iterator rend() { return (reverse_iterator(this->_start)); }
+  const_reverse_iterator rend() const {
+    return (const_reverse_iterator(this->_start));
+  }
+
+  size_type size() const { return (this->_end - this->_start); }
+  size_type max_size() const { return (this->_alloc.max_size()); }
+  size_type capacity() const { return (this->_end_capacity - this->_start); }
+  bool empty() const { return (this->_start == this->_end); }
+
+  // element가 안쪽 buffer에 있는지. (heap 할당이 없는 상태)
+  bool is_inline() const { return (this->_start == inline_data()); }
+
+  void resize(size_type n, value_type val = value_type()) {
+    if (n > max_size()) throw(std::length_error("ft::small_vector::resize"));
+    if (n <= this->size()) {
+      destroyer::destroy(this->_alloc, this->_start + n, this->_end);
+      this->_end = this->_start + n;
+    } else {
+      if (n > this->capacity()) {
+        this->reserve(
+            recommend_capacity(n - this->size(), "ft::small_vector::resize"));
+      }
+      this->_end =
+          relocator::fill(this->_alloc, this->_end, n - this->size(), val);
+    }
+  }
+
+  void reserve(size_type n) {
+    if (n > max_size()) {
+      throw(std::length_error("ft::small_vector::reserve"));
+    }
+    if (n > this->capacity()) {
+      reallocate(n);
+    }
+  }
+
+  // heap에 있고 size가 N 이하면 안쪽 buffer로 돌아온다.
+  void shrink_to_fit() {
+    if (!is_inline() && this->_end != this->_end_capacity) {
+      reallocate(this->size());
+    }
+  }
+
+  reference operator[](size_type n) { return (*(this->_start + n)); }
+  const_reference operator[](size_type n) const {
+    return (*(this->_start + n));
+  }
+
+  reference at(size_type n) {
+    if (n >= this->size()) {
+      throw(std::out_of_range("ft::small_vector::at"));
+    }
+    return ((*this)[n]);
+  }
+
+  const_reference at(size_type n) const {
+    if (n >= this->size()) {
+      throw(std::out_of_range("ft::small_vector::at"));
+    }
+    return ((*this)[n]);
+  }
+
+  reference front() { return (*(this->_start)); }
+  const_reference front() const { return (*(this->_start)); }
+  reference back() { return (*(this->_end - 1)); }
+  const_reference back() const { return (*(this->_end - 1)); }
+
+  template < typename InputIterator >
+  void assign(InputIterator first, InputIterator last,
+              typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                      InputIterator >::type * = u_nullptr) {
+    this->clear();
+    this->insert(this->end(), first, last);
+  }
+
+  void assign(size_type n, const value_type &val) {
+    // val이 이 vector의 element일 수도 있으므로 먼저 복사해둔다.
+    value_type val_copy = val;
+
+    this->clear();
+    if (n > this->capacity()) {
+      release();
+      this->_start = this->_alloc.allocate(n);
+      this->_end = this->_start;
+      this->_end_capacity = this->_start + n;
+    }
+    this->_end = relocator::fill(this->_alloc, this->_start, n, val_copy);
+  }
+
+  void push_back(const value_type &val) {
+    if (this->_end == this->_end_capacity) {
+      // val이 이 vector의 element일 수도 있으므로 insert로 처리한다.
+      this->insert(this->end(), 1, val);
+      return;
+    }
+    this->_alloc.construct(this->_end, val);
+    ++this->_end;
+  }
+
+#if __cplusplus >= 201103L
+  void push_back(value_type &&val) { this->emplace_back(std::move(val)); }
+
+  // ft::vector::emplace_back과 같다. (새 buffer는 항상 heap)
+  template < typename... Args >
+  void emplace_back(Args &&...args) {
+    if (this->_end != this->_end_capacity) {
+      std::allocator_traits< allocator_type >::construct(
+          this->_alloc, this->_end, std::forward< Args >(args)...);
+      ++this->_end;
+      return;
+    }
+    size_type len = recommend_capacity(1, "ft::small_vector::emplace_back");
+    pointer new_start = this->_alloc.allocate(len);
+    pointer new_end = new_start + this->size();
+
+    try {
+      std::allocator_traits< allocator_type >::construct(
+          this->_alloc, new_end, std::forward< Args >(args)...);
+    } catch (...) {
+      this->_alloc.deallocate(new_start, len);
+      throw;
+    }
+    reallocate_around(this->_end, new_start, new_end + 1, len);
+  }
+#endif
+
+  void pop_back() { this->_alloc.destroy(--this->_end); }
+
+  iterator insert(iterator position, const value_type &val) {
+    size_type position_idx = position.base() - this->_start;
+    this->insert(position, 1, val);
+    return (this->begin() + position_idx);
+  }
+
+  // gap을 여는 방식은 ft::vector::insert와 같다.
+  void insert(iterator position, size_type n, const value_type &val) {
+    if (n == 0) return;
+    pointer pos = position.base();
+
+    if (size_type(this->_end_capacity - this->_end) >= n) {
+      this->_end = ops::fill_insert(this->_alloc, pos, this->_end, n, val);
+    } else {
+      size_type len = recommend_capacity(n, "ft::small_vector::insert");
+      pointer new_start = this->_alloc.allocate(len);
+      pointer new_end = new_start + (pos - this->_start);
+
+      try {
+        relocator::fill(this->_alloc, new_end, n, val);
+      } catch (...) {
+        this->_alloc.deallocate(new_start, len);
+        throw;
+      }
+      new_end += n;
+      reallocate_around(pos, new_start, new_end, len);
+    }
+  }
+
+  template < typename InputIterator >
+  void insert(
+      iterator position, InputIterator first, InputIterator last,
+      typename ft::enable_if< !ft::is_integral< InputIterator >::value >::type
+          * = u_nullptr) {
+    insert_range(position.base(), first, last, ft::iterator_category(first));
+  }
+
+  iterator erase(iterator position) { return (erase(position, position + 1)); }
+
+  iterator erase(iterator first, iterator last) {
+    this->_end =
+        ops::erase(this->_alloc, first.base(), last.base(), this->_end);
+    return (first);
+  }
+
+  // 둘 다 heap에 있으면 pointer만 바꾼다. 아니면 element를 복사해서 바꾼다.
+  void swap(small_vector &x) {
+    if (!this->is_inline() && !x.is_inline()) {
+      std::swap(this->_start, x._start);
+      std::swap(this->_end, x._end);
+      std::swap(this->_end_capacity, x._end_capacity);
+      std::swap(this->_alloc, x._alloc);
+      return;
+    }
+    small_vector tmp(x);
+    x = *this;
+    *this = tmp;
+  }
+
+  void clear() {
+    destroyer::destroy(this->_alloc, this->_start, this->_end);
+    this->_end = this->_start;
+  }
+
+  allocator_type get_allocator() const { return (this->_alloc); }
+
+ private:
+  pointer inline_data() { return (reinterpret_cast< pointer >(_buf.bytes)); }
+  const_pointer inline_data() const {
+    return (reinterpret_cast< const_pointer >(_buf.bytes));
+  }
+
+  void reset_inline() {
+    this->_start = inline_data();
+    this->_end = this->_start;
+    this->_end_capacity = this->_start + N;
+  }
+
+  // heap buffer를 반환하고 안쪽 buffer를 가리킨다. (element는 비어있어야 함)
+  void release() {
+    if (!is_inline()) {
+      this->_alloc.deallocate(this->_start, this->capacity());
+    }
+    reset_inline();
+  }
+
+#if __cplusplus >= 201103L
+  // 비어 있고 안쪽 buffer를 가리키는 상태에서 x의 element를 가져온다.
+  void take(small_vector &x) {
+    if (x.is_inline()) {
+      this->_end =
+          relocator::move(this->_alloc, x._start, x._end, this->_start);
+      x.clear();
+    } else {
+      this->_start = x._start;
+      this->_end = x._end;
+      this->_end_capacity = x._end_capacity;
+      x.reset_inline();
+    }
+  }
+#endif
+
+  size_type recommend_capacity(size_type n, const char *what) const {
+    if (this->max_size() - this->size() < n) {
+      throw(std::length_error(what));
+    }
+    return (Growth::next_capacity(this->capacity(), this->size() + n,
+                                  sizeof(value_type), this->max_size()));
+  }
+
+  /**
+   * capacity를 len으로 바꾼다. len이 N 이하면 안쪽 buffer를 쓴다.
+   * 새 자리에 먼저 옮긴(relocator::move) 뒤 기존 element를 정리하므로,
+   * 옮기다 예외가 나면 원래 상태 그대로다.
+   */
+  void reallocate(size_type len) {
+    const bool to_inline = (len <= N);
+    pointer new_start = to_inline ? inline_data() : this->_alloc.allocate(len);
+    pointer new_end;
+
+    try {
+      new_end =
+          relocator::move(this->_alloc, this->_start, this->_end, new_start);
+    } catch (...) {
+      if (!to_inline) {
+        this->_alloc.deallocate(new_start, len);
+      }
+      throw;
+    }
+    destroyer::destroy(this->_alloc, this->_start, this->_end);
+    if (!is_inline()) {
+      this->_alloc.deallocate(this->_start, this->capacity());
+    }
+    this->_start = new_start;
+    this->_end = new_end;
+    this->_end_capacity = new_start + (to_inline ? N : len);
+  }
+
+  // ft::vector::reallocate_around와 같다. (새 buffer는 항상 heap)
+  void reallocate_around(pointer pos, pointer new_start, pointer new_end,
+                         size_type len) {
+    pointer finish;
+
+    try {
+      finish = ops::copy_around(this->_alloc, this->_start, pos, this->_end,
+                                new_start, new_end);
+    } catch (...) {
+      this->_alloc.deallocate(new_start, len);
+      throw;
+    }
+    destroyer::destroy(this->_alloc, this->_start, this->_end);
+    if (!is_inline()) {
+      this->_alloc.deallocate(this->_start, this->capacity());
+    }
+    this->_start = new_start;
+    this->_end = finish;
+    this->_end_capacity = new_start + len;
+  }
+
+  template < typename InputIterator >
+  void insert_range(pointer pos, InputIterator first, InputIterator last,
+                    ft::input_iterator_tag) {
+    size_type idx = pos - this->_start;
+
+    for (; first != last; ++first, ++idx) {
+      this->insert(this->begin() + idx, *first);
+    }
+  }
+
+  template < typename ForwardIterator >
+  void insert_range(pointer pos, ForwardIterator first, ForwardIterator last,
+                    ft::forward_iterator_tag) {
+    size_type n = ft::distance(first, last);
+    if (n == 0) return;
+
+    if (size_type(this->_end_capacity - this->_end) >= n) {
+      this->_end =
+          ops::range_insert(this->_alloc, pos, this->_end, first, last, n);
+    } else {
+      size_type len = recommend_capacity(n, "ft::small_vector::insert");
+      pointer new_start = this->_alloc.allocate(len);
+      pointer new_end = new_start + (pos - this->_start);
+
+      try {
+        new_end = relocator::copy(this->_alloc, first, last, new_end);
+      } catch (...) {
+        this->_alloc.deallocate(new_start, len);
+        throw;
+      }
+      reallocate_around(pos, new_start, new_end, len);
+    }
+  }
+};
+
+// 비교 연산자는 ft::vector와 같은 것을 쓴다. (vector.hpp)
+template < typename T, size_t N, typename Alloc, typename Growth >
+struct is_vector_like< small_vector< T, N, Alloc, Growth > > {
+  static const bool value = true;
+};
+
+template < typename T, size_t N, typename Alloc, typename Growth >
+void swap(small_vector< T, N, Alloc, Growth > &x,
+          small_vector< T, N, Alloc, Growth > &y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif
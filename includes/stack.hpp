@@ -37,6 +37,22 @@ class stack {
   void push(const value_type& val) { this->ct.push_back(val); }
   void pop() { this->ct.pop_back(); }
 
+#if __cplusplus >= 201103L
+  explicit stack(container_type&& ctnr) : ct(std::move(ctnr)) {}
+  // 소멸자를 선언했으므로 move 생성자 / 대입은 직접 default로 둔다.
+  stack(const stack&) = default;
+  stack(stack&&) = default;
+  stack& operator=(const stack&) = default;
+  stack& operator=(stack&&) = default;
+
+  void push(value_type&& val) { this->ct.push_back(std::move(val)); }
+
+  template < class... Args >
+  void emplace(Args&&... args) {
+    this->ct.emplace_back(std::forward< Args >(args)...);
+  }
+#endif
+
   template < class U, class C >
   friend bool operator==(const stack< U, C >& lhs,
                          const stack< U, C >& rhs);
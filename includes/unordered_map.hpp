@@ -0,0 +1,386 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_map.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(UNORDERED_MAP_HPP)
+#define UNORDERED_MAP_HPP
+
+#include <memory>
+#include <stdexcept>
+
+#include "FlatMapIterator.hpp"
+#include "HashTable.hpp"
+#include "hash.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft {
+/**
+ * key 순서가 필요 없는 map. (HashTable 참고)
+ * key 배열은 HashTable이, value 배열은 여기서 같은 index로 갖는다.
+ * 탐색은 평균 O(1)이고 element마다 할당이 없다.
+ * iterator는 flat_map과 같이 두 배열을 같이 가리키며, 넣은 순서대로
+ * 돈다. (erase하면 마지막 element가 그 자리로 온다)
+ * insert / erase 후에는 모든 iterator가 무효가 된다. erase가 리턴하는
+ * iterator로는 계속 돌 수 있다.
+ */
+template < class Key, class T, class Hash = ft::hash< Key >,
+           class KeyEqual = ft::equal_to< Key >,
+           class Alloc = std::allocator< ft::pair< const Key, T > > >
+class unordered_map {
+ public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef ft::pair< const key_type, mapped_type > value_type;
+  typedef Hash hasher;
+  typedef KeyEqual key_equal;
+  typedef Alloc allocator_type;
+  typedef ft::FlatMapIterator< key_type, mapped_type > iterator;
+  typedef ft::FlatMapIterator< key_type, const mapped_type > const_iterator;
+  typedef typename iterator::reference reference;
+  typedef typename const_iterator::reference const_reference;
+  typedef typename iterator::pointer pointer;
+  typedef typename const_iterator::pointer const_pointer;
+  typedef typename iterator::difference_type difference_type;
+  typedef size_t size_type;
+
+ private:
+  typedef ft::HashTable< key_type, hasher, key_equal, Alloc > table_type;
+  typedef typename Alloc::template rebind< mapped_type >::other
+      mapped_alloc_type;
+  typedef ft::vector< mapped_type, mapped_alloc_type > mapped_vector;
+
+  table_type _table;
+  mapped_vector _values;
+  allocator_type _alloc;
+
+ public:
+  explicit unordered_map(size_type bucket_count = 0,
+                         const hasher& hf = hasher(),
+                         const key_equal& eq = key_equal(),
+                         const allocator_type& alloc = allocator_type())
+      : _table(bucket_count, hf, eq, alloc),
+        _values(mapped_alloc_type(alloc)),
+        _alloc(alloc) {}
+
+  template < class InputIterator >
+  unordered_map(InputIterator first, InputIterator last,
+                size_type bucket_count = 0, const hasher& hf = hasher(),
+                const key_equal& eq = key_equal(),
+                const allocator_type& alloc = allocator_type(),
+                typename ft::enable_if<
+                    !ft::is_integral< InputIterator >::value,
+                    InputIterator >::type* = u_nullptr)
+      : _table(bucket_count, hf, eq, alloc),
+        _values(mapped_alloc_type(alloc)),
+        _alloc(alloc) {
+    insert(first, last);
+  }
+
+  unordered_map(const unordered_map& x)
+      : _table(x._table), _values(x._values), _alloc(x._alloc) {}
+
+  virtual ~unordered_map() {}
+
+  // 복사본을 다 만든 뒤 바꾼다. (중간에 예외가 나도 *this는 그대로)
+  unordered_map& operator=(const unordered_map& x) {
+    if (this != &x) {
+      unordered_map tmp(x);
+      this->swap(tmp);
+    }
+    return (*this);
+  }
+
+#if __cplusplus >= 201103L
+  // 빈 table을 만든 뒤 x와 바꾼다. x는 빈 unordered_map으로 남는다.
+  unordered_map(unordered_map&& x)
+      : _table(0, x.hash_function(), x.key_eq(), x._alloc),
+        _values(mapped_alloc_type(x._alloc)),
+        _alloc(x._alloc) {
+    this->swap(x);
+  }
+
+  unordered_map& operator=(unordered_map&& x) {
+    if (this != &x) {
+      this->clear();
+      this->swap(x);
+    }
+    return (*this);
+  }
+#endif
+
+  iterator begin() { return (this->iterator_at(0)); }
+  const_iterator begin() const { return (this->iterator_at(0)); }
+  iterator end() { return (this->iterator_at(this->size())); }
+  const_iterator end() const { return (this->iterator_at(this->size())); }
+
+  bool empty() const { return (_table.empty()); }
+  size_type size() const { return (_table.size()); }
+  size_type max_size() const {
+    return (std::min(_table.max_size(), _values.max_size()));
+  }
+
+  // k가 없을 때만 mapped_type()을 insert 한다.
+  mapped_type& operator[](const key_type& k) {
+    return (try_emplace(k).first->second);
+  }
+
+  // k가 없으면 std::out_of_range.
+  mapped_type& at(const key_type& k) {
+    size_type i = _table.find(k);
+
+    if (i == this->size()) throw(std::out_of_range("ft::unordered_map::at"));
+    return (_values[i]);
+  }
+  const mapped_type& at(const key_type& k) const {
+    size_type i = _table.find(k);
+
+    if (i == this->size()) throw(std::out_of_range("ft::unordered_map::at"));
+    return (_values[i]);
+  }
+
+#if __cplusplus >= 201103L
+  /**
+   * k가 없으면 (k, mapped_type(args...))를 insert 한다.
+   * k가 이미 있으면 아무것도 만들지 않고 그 element를 리턴한다.
+   * 리턴값은 insert(val)과 같다.
+   */
+  template < class... Args >
+  pair< iterator, bool > try_emplace(const key_type& k, Args&&... args) {
+    unsigned int h = _table.hash_of(k);
+    size_type i = _table.find_hashed(k, h);
+
+    if (i != this->size()) {
+      return (ft::make_pair(this->iterator_at(i), false));
+    }
+    this->push_back(k, h, mapped_type(std::forward< Args >(args)...));
+    return (ft::make_pair(this->iterator_at(i), true));
+  }
+
+  // hint는 쓰지 않는다. (map과 인터페이스를 맞추기 위함)
+  template < class... Args >
+  iterator try_emplace(iterator, const key_type& k, Args&&... args) {
+    return (try_emplace(k, std::forward< Args >(args)...).first);
+  }
+
+  // args로 value_type을 먼저 만들어야 key를 알 수 있다.
+  template < class... Args >
+  pair< iterator, bool > emplace(Args&&... args) {
+    return (insert(value_type(std::forward< Args >(args)...)));
+  }
+
+  template < class... Args >
+  iterator emplace_hint(iterator, Args&&... args) {
+    return (insert(value_type(std::forward< Args >(args)...)).first);
+  }
+#else
+  /**
+   * k가 없으면 (k, mapped_type(obj))를 insert 한다.
+   * k가 이미 있으면 아무것도 만들지 않고 그 element를 리턴한다.
+   * 리턴값은 insert(val)과 같다.
+   */
+  pair< iterator, bool > try_emplace(const key_type& k) {
+    return (insert_unique(k, mapped_type()));
+  }
+
+  template < class M >
+  pair< iterator, bool > try_emplace(const key_type& k, const M& obj) {
+    return (insert_unique(k, obj));
+  }
+
+  // hint는 쓰지 않는다. (map과 인터페이스를 맞추기 위함)
+  iterator try_emplace(iterator, const key_type& k) {
+    return (insert_unique(k, mapped_type()).first);
+  }
+
+  template < class M >
+  iterator try_emplace(iterator, const key_type& k, const M& obj) {
+    return (insert_unique(k, obj).first);
+  }
+#endif
+
+  /**
+   * insert 성공시
+   * pair(새로운 element를 가리키는 iterator, true) 리턴.
+   * insert 실패시
+   * pair(val과 동일한 Key값 갖고있는 iterator, false) 리턴.
+   */
+  pair< iterator, bool > insert(const value_type& val) {
+    return (insert_unique(val.first, val.second));
+  }
+
+  // hint는 쓰지 않는다. (map과 인터페이스를 맞추기 위함)
+  iterator insert(iterator, const value_type& val) {
+    return (insert_unique(val.first, val.second).first);
+  }
+
+  template < class InputIterator >
+  void insert(InputIterator first, InputIterator last,
+              typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                      InputIterator >::type* = u_nullptr) {
+    for (; first != last; ++first) {
+      insert_unique((*first).first, (*first).second);
+    }
+  }
+
+  // 지운 자리를 리턴한다. 그 자리에는 마지막 element가 옮겨와 있다.
+  iterator erase(iterator position) {
+    return (this->iterator_at(
+        this->erase_index(position.key_base() - this->key_data())));
+  }
+
+  // erase 성공 시 1, 실패 시 0 리턴.
+  size_type erase(const key_type& k) {
+    size_type i = _table.find(k);
+
+    if (i == this->size()) return (0);
+    this->erase_index(i);
+    return (1);
+  }
+
+  // 뒤에서부터 지운다. 옮겨오는 마지막 element는 항상 구간 밖에 있다.
+  iterator erase(iterator first, iterator last) {
+    size_type i = first.key_base() - this->key_data();
+    size_type j = last.key_base() - this->key_data();
+
+    while (j > i) {
+      this->erase_index(--j);
+    }
+    return (this->iterator_at(i));
+  }
+
+  void swap(unordered_map& x) {
+    _table.swap(x._table);
+    _values.swap(x._values);
+    std::swap(this->_alloc, x._alloc);
+  }
+
+  void clear() {
+    _table.clear();
+    _values.clear();
+  }
+
+  iterator find(const key_type& k) {
+    return (this->iterator_at(_table.find(k)));
+  }
+  const_iterator find(const key_type& k) const {
+    return (this->iterator_at(_table.find(k)));
+  }
+
+  // map은 Key가 unique하기떄문에, 1 또는 0이다.
+  size_type count(const key_type& k) const {
+    return (_table.find(k) != this->size());
+  }
+
+  pair< iterator, iterator > equal_range(const key_type& k) {
+    iterator it = this->find(k);
+    return (ft::make_pair(it, it == this->end() ? it : it + 1));
+  }
+  pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+    const_iterator it = this->find(k);
+    return (ft::make_pair(it, it == this->end() ? it : it + 1));
+  }
+
+  size_type bucket_count() const { return (_table.bucket_count()); }
+  float load_factor() const { return (_table.load_factor()); }
+  float max_load_factor() const { return (_table.max_load_factor()); }
+  void max_load_factor(float ml) { _table.max_load_factor(ml); }
+  void rehash(size_type n) { _table.rehash(n); }
+
+  // n개까지 bucket, key / value 배열을 다시 잡지 않게 한다.
+  void reserve(size_type n) {
+    _table.reserve(n);
+    _values.reserve(n);
+  }
+
+  hasher hash_function() const { return (_table.hash_function()); }
+  key_equal key_eq() const { return (_table.key_eq()); }
+  allocator_type get_allocator() const { return (this->_alloc); }
+
+ private:
+  const key_type* key_data() const { return (_table.keys().begin().base()); }
+  mapped_type* value_data() { return (_values.begin().base()); }
+  const mapped_type* value_data() const { return (_values.begin().base()); }
+
+  iterator iterator_at(size_type i) {
+    return (iterator(this->key_data() + i, this->value_data() + i));
+  }
+  const_iterator iterator_at(size_type i) const {
+    return (const_iterator(this->key_data() + i, this->value_data() + i));
+  }
+
+  // value를 먼저 넣고 key를 넣는다. key 쪽에서 예외가 나면 value도 뺀다.
+  void push_back(const key_type& k, unsigned int h, const mapped_type& v) {
+    _values.push_back(v);
+    try {
+      _table.push_back(k, h);
+    } catch (...) {
+      _values.pop_back();
+      throw;
+    }
+  }
+
+  template < class M >
+  pair< iterator, bool > insert_unique(const key_type& k, const M& obj) {
+    unsigned int h = _table.hash_of(k);
+    size_type i = _table.find_hashed(k, h);
+
+    if (i != this->size()) {
+      return (ft::make_pair(this->iterator_at(i), false));
+    }
+    this->push_back(k, h, mapped_type(obj));
+    return (ft::make_pair(this->iterator_at(i), true));
+  }
+
+  // table과 같이 마지막 value를 i로 옮긴다.
+  size_type erase_index(size_type i) {
+    size_type last = this->size() - 1;
+
+    if (i != last) _values[i] = _values[last];
+    _values.pop_back();
+    return (_table.erase(i));
+  }
+};
+
+/**
+ * 순서와 상관없이 같은 (key, value)들을 갖는지.
+ * lhs의 element마다 rhs에서 찾으므로 평균 O(n).
+ */
+template < class Key, class T, class Hash, class KeyEqual, class Alloc >
+bool operator==(const unordered_map< Key, T, Hash, KeyEqual, Alloc >& lhs,
+                const unordered_map< Key, T, Hash, KeyEqual, Alloc >& rhs) {
+  typedef typename unordered_map< Key, T, Hash, KeyEqual,
+                                  Alloc >::const_iterator const_iterator;
+
+  if (lhs.size() != rhs.size()) return (false);
+  for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+    const_iterator found = rhs.find(it->first);
+
+    if (found == rhs.end() || !(found->second == it->second)) return (false);
+  }
+  return (true);
+}
+
+template < class Key, class T, class Hash, class KeyEqual, class Alloc >
+bool operator!=(const unordered_map< Key, T, Hash, KeyEqual, Alloc >& lhs,
+                const unordered_map< Key, T, Hash, KeyEqual, Alloc >& rhs) {
+  return (!(lhs == rhs));
+}
+
+template < class Key, class T, class Hash, class KeyEqual, class Alloc >
+void swap(unordered_map< Key, T, Hash, KeyEqual, Alloc >& x,
+          unordered_map< Key, T, Hash, KeyEqual, Alloc >& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif  // UNORDERED_MAP_HPP
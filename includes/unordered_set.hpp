@@ -0,0 +1,247 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_set.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#if !defined(UNORDERED_SET_HPP)
+#define UNORDERED_SET_HPP
+
+#include <memory>
+
+#include "HashTable.hpp"
+#include "hash.hpp"
+#include "utils.hpp"
+#include "vector.hpp"
+
+namespace ft {
+/**
+ * key 순서가 필요 없는 set. (unordered_map 참고)
+ * HashTable의 key 배열을 그대로 iterator로 쓴다.
+ * element를 바꾸면 hash가 깨지므로 iterator도 const_iterator와 같다.
+ * insert / erase 후에는 모든 iterator가 무효가 된다. erase가 리턴하는
+ * iterator로는 계속 돌 수 있다.
+ */
+template < class T, class Hash = ft::hash< T >,
+           class KeyEqual = ft::equal_to< T >,
+           class Alloc = std::allocator< T > >
+class unordered_set {
+ public:
+  typedef T key_type;
+  typedef T value_type;
+  typedef Hash hasher;
+  typedef KeyEqual key_equal;
+  typedef Alloc allocator_type;
+  typedef typename allocator_type::reference reference;
+  typedef typename allocator_type::const_reference const_reference;
+  typedef typename allocator_type::pointer pointer;
+  typedef typename allocator_type::const_pointer const_pointer;
+
+ private:
+  typedef ft::HashTable< key_type, hasher, key_equal, Alloc > table_type;
+  typedef typename table_type::key_vector key_vector;
+
+ public:
+  typedef typename key_vector::const_iterator iterator;
+  typedef typename key_vector::const_iterator const_iterator;
+  typedef typename key_vector::difference_type difference_type;
+  typedef size_t size_type;
+
+ private:
+  table_type _table;
+  allocator_type _alloc;
+
+ public:
+  explicit unordered_set(size_type bucket_count = 0,
+                         const hasher& hf = hasher(),
+                         const key_equal& eq = key_equal(),
+                         const allocator_type& alloc = allocator_type())
+      : _table(bucket_count, hf, eq, alloc), _alloc(alloc) {}
+
+  template < class InputIterator >
+  unordered_set(InputIterator first, InputIterator last,
+                size_type bucket_count = 0, const hasher& hf = hasher(),
+                const key_equal& eq = key_equal(),
+                const allocator_type& alloc = allocator_type(),
+                typename ft::enable_if<
+                    !ft::is_integral< InputIterator >::value,
+                    InputIterator >::type* = u_nullptr)
+      : _table(bucket_count, hf, eq, alloc), _alloc(alloc) {
+    insert(first, last);
+  }
+
+  unordered_set(const unordered_set& x)
+      : _table(x._table), _alloc(x._alloc) {}
+
+  virtual ~unordered_set() {}
+
+  // 복사본을 다 만든 뒤 바꾼다. (중간에 예외가 나도 *this는 그대로)
+  unordered_set& operator=(const unordered_set& x) {
+    if (this != &x) {
+      unordered_set tmp(x);
+      this->swap(tmp);
+    }
+    return (*this);
+  }
+
+#if __cplusplus >= 201103L
+  // 빈 table을 만든 뒤 x와 바꾼다. x는 빈 unordered_set으로 남는다.
+  unordered_set(unordered_set&& x)
+      : _table(0, x.hash_function(), x.key_eq(), x._alloc),
+        _alloc(x._alloc) {
+    this->swap(x);
+  }
+
+  unordered_set& operator=(unordered_set&& x) {
+    if (this != &x) {
+      this->clear();
+      this->swap(x);
+    }
+    return (*this);
+  }
+#endif
+
+  const_iterator begin() const { return (_table.keys().begin()); }
+  const_iterator end() const { return (_table.keys().end()); }
+
+  bool empty() const { return (_table.empty()); }
+  size_type size() const { return (_table.size()); }
+  size_type max_size() const { return (_table.max_size()); }
+
+  /**
+   * insert 성공시
+   * pair(새로운 element를 가리키는 iterator, true) 리턴.
+   * insert 실패시
+   * pair(val과 동일한 Key값 갖고있는 iterator, false) 리턴.
+   */
+  pair< iterator, bool > insert(const value_type& val) {
+    pair< size_type, bool > ret = _table.insert(val);
+
+    return (ft::make_pair(this->iterator_at(ret.first), ret.second));
+  }
+
+  // hint는 쓰지 않는다. (set과 인터페이스를 맞추기 위함)
+  iterator insert(iterator, const value_type& val) {
+    return (this->iterator_at(_table.insert(val).first));
+  }
+
+  template < class InputIterator >
+  void insert(InputIterator first, InputIterator last,
+              typename ft::enable_if< !ft::is_integral< InputIterator >::value,
+                                      InputIterator >::type* = u_nullptr) {
+    for (; first != last; ++first) {
+      _table.insert(*first);
+    }
+  }
+
+#if __cplusplus >= 201103L
+  // args로 value_type을 먼저 만들어야 key를 알 수 있다.
+  template < class... Args >
+  pair< iterator, bool > emplace(Args&&... args) {
+    return (insert(value_type(std::forward< Args >(args)...)));
+  }
+
+  template < class... Args >
+  iterator emplace_hint(iterator, Args&&... args) {
+    return (insert(value_type(std::forward< Args >(args)...)).first);
+  }
+#endif
+
+  // 지운 자리를 리턴한다. 그 자리에는 마지막 element가 옮겨와 있다.
+  iterator erase(iterator position) {
+    return (this->begin() + _table.erase(position - this->begin()));
+  }
+
+  // erase 성공 시 1, 실패 시 0 리턴.
+  size_type erase(const key_type& k) {
+    size_type i = _table.find(k);
+
+    if (i == this->size()) return (0);
+    _table.erase(i);
+    return (1);
+  }
+
+  // 뒤에서부터 지운다. 옮겨오는 마지막 element는 항상 구간 밖에 있다.
+  iterator erase(iterator first, iterator last) {
+    size_type i = first - this->begin();
+    size_type j = last - this->begin();
+
+    while (j > i) {
+      _table.erase(--j);
+    }
+    return (this->begin() + i);
+  }
+
+  void swap(unordered_set& x) {
+    _table.swap(x._table);
+    std::swap(this->_alloc, x._alloc);
+  }
+
+  void clear() { _table.clear(); }
+
+  const_iterator find(const key_type& k) const {
+    return (this->iterator_at(_table.find(k)));
+  }
+
+  // set은 Key가 unique하기떄문에, 1 또는 0이다.
+  size_type count(const key_type& k) const {
+    return (_table.find(k) != this->size());
+  }
+
+  pair< const_iterator, const_iterator > equal_range(const key_type& k) const {
+    const_iterator it = this->find(k);
+    return (ft::make_pair(it, it == this->end() ? it : it + 1));
+  }
+
+  size_type bucket_count() const { return (_table.bucket_count()); }
+  float load_factor() const { return (_table.load_factor()); }
+  float max_load_factor() const { return (_table.max_load_factor()); }
+  void max_load_factor(float ml) { _table.max_load_factor(ml); }
+  void rehash(size_type n) { _table.rehash(n); }
+  void reserve(size_type n) { _table.reserve(n); }
+
+  hasher hash_function() const { return (_table.hash_function()); }
+  key_equal key_eq() const { return (_table.key_eq()); }
+  allocator_type get_allocator() const { return (this->_alloc); }
+
+ private:
+  const_iterator iterator_at(size_type i) const {
+    return (this->begin() + i);
+  }
+};
+
+// 순서와 상관없이 같은 element들을 갖는지. 평균 O(n).
+template < class T, class Hash, class KeyEqual, class Alloc >
+bool operator==(const unordered_set< T, Hash, KeyEqual, Alloc >& lhs,
+                const unordered_set< T, Hash, KeyEqual, Alloc >& rhs) {
+  typedef typename unordered_set< T, Hash, KeyEqual, Alloc >::const_iterator
+      const_iterator;
+
+  if (lhs.size() != rhs.size()) return (false);
+  for (const_iterator it = lhs.begin(); it != lhs.end(); ++it) {
+    if (!rhs.count(*it)) return (false);
+  }
+  return (true);
+}
+
+template < class T, class Hash, class KeyEqual, class Alloc >
+bool operator!=(const unordered_set< T, Hash, KeyEqual, Alloc >& lhs,
+                const unordered_set< T, Hash, KeyEqual, Alloc >& rhs) {
+  return (!(lhs == rhs));
+}
+
+template < class T, class Hash, class KeyEqual, class Alloc >
+void swap(unordered_set< T, Hash, KeyEqual, Alloc >& x,
+          unordered_set< T, Hash, KeyEqual, Alloc >& y) {
+  x.swap(y);
+}
+
+}  // namespace ft
+
+#endif  // UNORDERED_SET_HPP
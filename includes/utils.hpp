@@ -13,6 +13,12 @@
 #if !defined(UTILS_HPP)
 #define UTILS_HPP
 
+#include <cstring>
+#include <memory>
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
 #include "iterator.hpp"
 
 namespace ft {
@@ -33,17 +39,83 @@ static class nullptr_t {
   void operator&() const;
 } u_nullptr = {};
 
+/**
+ * distance, advance는 iterator의 category에 따라 구현을 고른다.
+ * random access iterator면 O(1)로 계산하고, 아니면 한 칸씩 센다.
+ */
 template < typename InputIterator >
-typename ft::iterator_traits< InputIterator >::difference_type distance(
-    InputIterator first, InputIterator last) {
+typename ft::iterator_traits< InputIterator >::difference_type distance_by_tag(
+    InputIterator first, InputIterator last, ft::input_iterator_tag) {
   typename ft::iterator_traits< InputIterator >::difference_type dist = 0;
 
-  for (; first != last; first++) {
-    dist++;
+  for (; first != last; ++first) {
+    ++dist;
   }
   return (dist);
 }
 
+template < typename RandomAccessIterator >
+typename ft::iterator_traits< RandomAccessIterator >::difference_type
+distance_by_tag(RandomAccessIterator first, RandomAccessIterator last,
+                ft::random_access_iterator_tag) {
+  return (last - first);
+}
+
+// distance_by_tag를 qualify 하지 않고 불러서, 뒤에 선언된 iterator 전용
+// 구현(RB_TreeIterator의 O(log n) 버전)도 ADL로 찾게 한다.
+template < typename InputIterator >
+typename ft::iterator_traits< InputIterator >::difference_type distance(
+    InputIterator first, InputIterator last) {
+  return (distance_by_tag(first, last, ft::iterator_category(first)));
+}
+
+// input / forward iterator는 앞으로만 갈 수 있다. (n >= 0)
+template < typename InputIterator, typename Distance >
+void advance_by_tag(InputIterator& it, Distance n, ft::input_iterator_tag) {
+  for (; n > 0; --n) {
+    ++it;
+  }
+}
+
+template < typename BidirectionalIterator, typename Distance >
+void advance_by_tag(BidirectionalIterator& it, Distance n,
+                    ft::bidirectional_iterator_tag) {
+  for (; n > 0; --n) {
+    ++it;
+  }
+  for (; n < 0; ++n) {
+    --it;
+  }
+}
+
+template < typename RandomAccessIterator, typename Distance >
+void advance_by_tag(RandomAccessIterator& it, Distance n,
+                    ft::random_access_iterator_tag) {
+  it += n;
+}
+
+template < typename InputIterator, typename Distance >
+void advance(InputIterator& it, Distance n) {
+  ft::advance_by_tag(it, n, ft::iterator_category(it));
+}
+
+template < typename InputIterator >
+InputIterator next(
+    InputIterator it,
+    typename ft::iterator_traits< InputIterator >::difference_type n = 1) {
+  ft::advance(it, n);
+  return (it);
+}
+
+template < typename BidirectionalIterator >
+BidirectionalIterator prev(
+    BidirectionalIterator it,
+    typename ft::iterator_traits< BidirectionalIterator >::difference_type n =
+        1) {
+  ft::advance(it, -n);
+  return (it);
+}
+
 /**
  * Cond가 true인 경우를 specialize하여 type을 typename으로 사용할 수 있게 한다.
  */
@@ -137,6 +209,185 @@ struct is_integral_type< unsigned long long int >
 template < typename T >
 struct is_integral : public is_integral_type< T > {};
 
+/**
+ * T를 memcpy / memmove로 옮겨도 되는지, destroy를 생략해도 되는지.
+ * C++98에는 type_traits가 없으므로 컴파일러 builtin을 쓴다.
+ * (clang은 __has_trivial_destructor를 deprecated로 경고한다)
+ */
+template < typename T >
+struct is_trivially_copyable
+    : public integral_traits< __is_trivially_copyable(T), T > {};
+
+#if defined(__clang__)
+template < typename T >
+struct is_trivially_destructible
+    : public integral_traits< __is_trivially_destructible(T), T > {};
+#else
+template < typename T >
+struct is_trivially_destructible
+    : public integral_traits< __has_trivial_destructor(T), T > {};
+#endif
+
+/**
+ * allocator가 std::allocator< T > 인지.
+ * 다른 allocator는 construct / destroy에 부수효과가 있을 수 있으므로
+ * 아래의 memcpy / destroy 생략 경로를 쓰지 않는다.
+ */
+template < typename Alloc, typename T >
+struct is_default_allocator : public integral_traits< false, T > {};
+
+template < typename T >
+struct is_default_allocator< std::allocator< T >, T >
+    : public integral_traits< true, T > {};
+
+// 두 type이 같은지.
+template < typename T, typename U >
+struct is_same : public integral_traits< false, T > {};
+
+template < typename T >
+struct is_same< T, T > : public integral_traits< true, T > {};
+
+// T에서 const를 뗀 type.
+template < typename T >
+struct remove_const {
+  typedef T type;
+};
+
+template < typename T >
+struct remove_const< const T > {
+  typedef T type;
+};
+
+/**
+ * vector의 element를 construct 하는 함수 모음.
+ * Trivial이 false면 element마다 construct 하고, true면 memcpy로 한 번에
+ * 복사한다. (dst 쪽은 construct 되지 않은 메모리여야 한다)
+ * 모두 중간에 예외가 나면 자기가 만든 element를 destroy 하고 다시 던지며,
+ * 원본은 건드리지 않는다. 원본의 destroy는 호출하는 쪽이 한다.
+ */
+template < bool Trivial >
+struct relocator {
+  /**
+   * 곧 버릴 buffer의 [first, last)를 dst에 construct 한다. 원본은 destroy
+   * 하지 않는다. C++11에서는 move가 noexcept일 때만 move 하고 아니면
+   * copy 하므로, 중간에 예외가 나도 원본은 그대로다.
+   */
+  template < typename Alloc, typename T >
+  static T* move(Alloc& alloc, T* first, T* last, T* dst) {
+#if __cplusplus >= 201103L
+    T* cur = dst;
+
+    try {
+      for (; first != last; ++first, ++cur) {
+        alloc.construct(cur, std::move_if_noexcept(*first));
+      }
+    } catch (...) {
+      while (cur != dst) {
+        alloc.destroy(--cur);
+      }
+      throw;
+    }
+    return (cur);
+#else
+    return (copy(alloc, first, last, dst));
+#endif
+  }
+
+  // [first, last)를 dst에 copy-construct 한다. 중간에 예외가 나면 만든
+  // element를 destroy 하고 다시 던진다.
+  template < typename Alloc, typename InputIterator, typename T >
+  static T* copy(Alloc& alloc, InputIterator first, InputIterator last,
+                 T* dst) {
+    T* cur = dst;
+
+    try {
+      for (; first != last; ++first, ++cur) {
+        alloc.construct(cur, *first);
+      }
+    } catch (...) {
+      while (cur != dst) {
+        alloc.destroy(--cur);
+      }
+      throw;
+    }
+    return (cur);
+  }
+
+  // dst부터 n개를 val로 copy-construct 한다. 예외 처리는 copy와 같다.
+  template < typename Alloc, typename Size, typename T >
+  static T* fill(Alloc& alloc, T* dst, Size n, const T& val) {
+    T* cur = dst;
+
+    try {
+      for (; n > 0; --n, ++cur) {
+        alloc.construct(cur, val);
+      }
+    } catch (...) {
+      while (cur != dst) {
+        alloc.destroy(--cur);
+      }
+      throw;
+    }
+    return (cur);
+  }
+};
+
+template <>
+struct relocator< true > {
+  template < typename Alloc, typename InputIterator, typename T >
+  static T* copy(Alloc& alloc, InputIterator first, InputIterator last,
+                 T* dst) {
+    return (relocator< false >::copy(alloc, first, last, dst));
+  }
+
+  template < typename Alloc, typename Size, typename T >
+  static T* fill(Alloc& alloc, T* dst, Size n, const T& val) {
+    return (relocator< false >::fill(alloc, dst, n, val));
+  }
+
+  template < typename Alloc, typename T >
+  static T* move(Alloc& alloc, T* first, T* last, T* dst) {
+    return (copy(alloc, first, last, dst));
+  }
+
+  // 연속된 메모리에서 오는 경우만 memcpy.
+  template < typename Alloc, typename T >
+  static T* copy(Alloc&, T* first, T* last, T* dst) {
+    if (first != last) {
+      std::memcpy(static_cast< void* >(dst), first, (last - first) * sizeof(T));
+    }
+    return (dst + (last - first));
+  }
+
+  template < typename Alloc, typename T >
+  static T* copy(Alloc&, const T* first, const T* last, T* dst) {
+    if (first != last) {
+      std::memcpy(static_cast< void* >(dst), first, (last - first) * sizeof(T));
+    }
+    return (dst + (last - first));
+  }
+};
+
+/**
+ * [first, last)의 element를 destroy 한다.
+ * Trivial이 true면 할 일이 없다.
+ */
+template < bool Trivial >
+struct destroyer {
+  template < typename Alloc, typename T >
+  static void destroy(Alloc& alloc, T* first, T* last) {
+    for (; first != last; ++first) {
+      alloc.destroy(first);
+    }
+  }
+};
+
+template <>
+struct destroyer< true > {
+  template < typename Alloc, typename T >
+  static void destroy(Alloc&, T*, T*) {}
+};
+
 /**
  * 사전식 순서 비교_1
  */
@@ -206,12 +457,52 @@ struct binary_function {
   typedef Result result_type;
 };
 
-template < class T >
+template < class T = void >
 struct less : binary_function< T, T, bool > {
   bool operator()(const T& x, const T& y) const {
     return x < y; }
 };
 
+/**
+ * 인자 type을 고정하지 않는 less. (transparent comparator)
+ * map< std::string, T, ft::less<> > 에서 find("key") 처럼
+ * key_type을 만들지 않고 탐색할 수 있다.
+ */
+template <>
+struct less< void > {
+  typedef void is_transparent;
+
+  template < class T, class U >
+  bool operator()(const T& x, const U& y) const {
+    return x < y;
+  }
+};
+
+// unordered_map, unordered_set의 기본 key 비교.
+template < class T >
+struct equal_to : binary_function< T, T, bool > {
+  bool operator()(const T& x, const T& y) const { return (x == y); }
+};
+
+/**
+ * Compare에 is_transparent type이 정의되어 있는지 체크한다.
+ * transparent comparator인 경우에만 map, set의 find, count 등이
+ * key_type이 아닌 type으로도 탐색할 수 있게 한다.
+ * K는 결과에 영향이 없고, 멤버 함수 template에서 SFINAE가 되도록
+ * 탐색할 key type을 같이 넘기기 위한 것.
+ */
+template < typename Compare, typename K = void >
+struct is_transparent {
+ private:
+  template < typename U >
+  static char test(typename U::is_transparent*);
+  template < typename U >
+  static long test(...);
+
+ public:
+  static const bool value = (sizeof(test< Compare >(0)) == sizeof(char));
+};
+
 template < class T1, class T2 >
 struct pair {
  public:
@@ -233,6 +524,27 @@ struct pair {
     }
     return (*this);
   }
+
+#if __cplusplus >= 201103L
+  // operator=를 선언했으므로 copy / move 생성자는 직접 default로 둔다.
+  pair(const pair&) = default;
+  pair(pair&&) = default;
+
+  template < class U, class V >
+  pair(U&& a, V&& b)
+      : first(std::forward< U >(a)), second(std::forward< V >(b)) {}
+
+  template < class U, class V >
+  pair(pair< U, V >&& pr)
+      : first(std::forward< U >(pr.first)),
+        second(std::forward< V >(pr.second)) {}
+
+  pair& operator=(pair&& pr) {
+    this->first = std::move(pr.first);
+    this->second = std::move(pr.second);
+    return (*this);
+  }
+#endif
 };
 
 template < class T1, class T2 >
@@ -13,14 +13,185 @@
 #ifndef VECTOR_HPP
 #define VECTOR_HPP
 
+#include <algorithm>
 #include <memory>
+#include <stdexcept>
 
 #include "VectorIterator.hpp"
+#include "growth_policy.hpp"
 #include "utils.hpp"
 
 namespace ft {
 
-template < typename T, typename Allocator = std::allocator< T > >
+/**
+ * vector와 small_vector가 같이 쓰는 element 이동 알고리즘.
+ * buffer를 잡고 반환하는 일은 각 container가 하고, 여기서는 이미 잡힌
+ * buffer 안에서 element만 옮긴다.
+ * 예외가 나면 자기가 만든 element는 destroy 하고 다시 던진다.
+ */
+template < typename Relocator, typename Destroyer >
+struct vector_ops {
+  /**
+   * capacity가 충분할 때 pos 앞에 val을 n개 넣고 새 end를 리턴한다.
+   * 뒤쪽을 n칸 밀어 gap을 만든다. construct 되지 않은 끝쪽 자리에만
+   * construct 하고, 이미 element가 있는 자리는 대입한다.
+   * 대입 중에 예외가 나면 끝쪽에 만든 [end, new_end)를 destroy 한다.
+   * (앞쪽 element는 대입하던 상태로 남는다)
+   */
+  template < typename Alloc, typename T, typename Size >
+  static T *fill_insert(Alloc &alloc, T *pos, T *end, Size n, const T &val) {
+    // val이 이 vector의 element일 수도 있으므로 먼저 복사해둔다.
+    T val_copy = val;
+    Size elems_after = end - pos;
+    T *new_end;
+
+    if (elems_after > n) {
+      new_end = Relocator::copy(alloc, end - n, end, end);
+      try {
+        std::copy_backward(pos, end - n, end);
+        std::fill(pos, pos + n, val_copy);
+      } catch (...) {
+        Destroyer::destroy(alloc, end, new_end);
+        throw;
+      }
+    } else {
+      new_end = Relocator::fill(alloc, end, n - elems_after, val_copy);
+      try {
+        new_end = Relocator::copy(alloc, pos, end, new_end);
+        std::fill(pos, end, val_copy);
+      } catch (...) {
+        Destroyer::destroy(alloc, end, new_end);
+        throw;
+      }
+    }
+    return (new_end);
+  }
+
+  // fill_insert와 같은 방식으로 [first, last)의 n개를 넣는다.
+  template < typename Alloc, typename T, typename ForwardIterator,
+             typename Size >
+  static T *range_insert(Alloc &alloc, T *pos, T *end, ForwardIterator first,
+                         ForwardIterator last, Size n) {
+    Size elems_after = end - pos;
+    T *new_end;
+
+    if (elems_after > n) {
+      new_end = Relocator::copy(alloc, end - n, end, end);
+      try {
+        std::copy_backward(pos, end - n, end);
+        std::copy(first, last, pos);
+      } catch (...) {
+        Destroyer::destroy(alloc, end, new_end);
+        throw;
+      }
+    } else {
+      ForwardIterator mid = ft::next(first, elems_after);
+      new_end = Relocator::copy(alloc, mid, last, end);
+      try {
+        new_end = Relocator::copy(alloc, pos, end, new_end);
+        std::copy(first, mid, pos);
+      } catch (...) {
+        Destroyer::destroy(alloc, end, new_end);
+        throw;
+      }
+    }
+    return (new_end);
+  }
+
+  // [first, last)를 지우고 새 end를 리턴한다.
+  // 뒷부분을 앞으로 대입해서 gap을 닫고, 남은 끝쪽 element만 destroy 한다.
+  template < typename Alloc, typename T >
+  static T *erase(Alloc &alloc, T *first, T *last, T *end) {
+    if (first == last) return (end);
+
+    T *new_end = std::copy(last, end, first);
+    Destroyer::destroy(alloc, new_end, end);
+    return (new_end);
+  }
+
+  /**
+   * 새 element가 새 buffer의 [pos에 해당하는 자리, new_end)에 이미 만들어진
+   * 상태에서, 기존 element의 앞부분 [start, pos)와 뒷부분 [pos, end)를 그
+   * 양옆으로 옮기고(Relocator::move) 새 buffer의 end를 리턴한다.
+   * 예외가 나면 새 buffer에 만든 element(새 element 포함)를 모두 destroy
+   * 한다. 기존 buffer는 건드리지 않는다.
+   */
+  template < typename Alloc, typename T >
+  static T *copy_around(Alloc &alloc, T *start, T *pos, T *end, T *new_start,
+                        T *new_end) {
+    T *inserted = new_start + (pos - start);
+
+    try {
+      Relocator::move(alloc, start, pos, new_start);
+      try {
+        return (Relocator::move(alloc, pos, end, new_end));
+      } catch (...) {
+        Destroyer::destroy(alloc, new_start, inserted);
+        throw;
+      }
+    } catch (...) {
+      Destroyer::destroy(alloc, inserted, new_end);
+      throw;
+    }
+  }
+};
+
+/**
+ * vector와 small_vector가 같이 쓰는 비교 연산자.
+ * 각 container는 is_vector_like를 특수화해서 이 연산자들을 켠다.
+ * 같은 타입끼리만 비교하고, element 비교는 ft::equal /
+ * ft::lexicographical_compare에 맡긴다.
+ */
+template < typename Container >
+struct is_vector_like {
+  static const bool value = false;
+};
+
+template < typename Container >
+typename ft::enable_if< is_vector_like< Container >::value, bool >::type
+operator==(const Container &lhs, const Container &rhs) {
+  return (lhs.size() == rhs.size() &&
+          ft::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template < typename Container >
+typename ft::enable_if< is_vector_like< Container >::value, bool >::type
+operator!=(const Container &lhs, const Container &rhs) {
+  return (!(lhs == rhs));
+}
+
+template < typename Container >
+typename ft::enable_if< is_vector_like< Container >::value, bool >::type
+operator<(const Container &lhs, const Container &rhs) {
+  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
+                                      rhs.end()));
+}
+
+template < typename Container >
+typename ft::enable_if< is_vector_like< Container >::value, bool >::type
+operator<=(const Container &lhs, const Container &rhs) {
+  return (!(rhs < lhs));
+}
+
+template < typename Container >
+typename ft::enable_if< is_vector_like< Container >::value, bool >::type
+operator>(const Container &lhs, const Container &rhs) {
+  return (rhs < lhs);
+}
+
+template < typename Container >
+typename ft::enable_if< is_vector_like< Container >::value, bool >::type
+operator>=(const Container &lhs, const Container &rhs) {
+  return (!(lhs < rhs));
+}
+
+/**
+ * Growth는 capacity를 늘리는 규칙. (growth_policy.hpp)
+ * push_back, resize, insert처럼 크기가 늘면서 reallocation 하는 곳은 모두
+ * Growth를 따르고, reserve와 생성자는 요청한 크기만큼만 잡는다.
+ */
+template < typename T, typename Allocator = std::allocator< T >,
+           typename Growth = ft::growth_double >
 class vector {
  public:
   typedef T value_type;
@@ -35,8 +206,19 @@ class vector {
   typedef ft::reverse_iterator< const_iterator > const_reverse_iterator;
   typedef typename allocator_type::size_type size_type;
   typedef typename allocator_type::difference_type difference_type;
+  typedef Growth growth_policy;
 
  private:
+  // T가 trivially copyable / destructible이면 element를 옮길 때 memcpy를 쓰고
+  // destroy를 생략한다. (std::allocator인 경우만)
+  typedef ft::relocator< ft::is_trivially_copyable< T >::value &&
+                         ft::is_default_allocator< Allocator, T >::value >
+      relocator;
+  typedef ft::destroyer< ft::is_trivially_destructible< T >::value &&
+                         ft::is_default_allocator< Allocator, T >::value >
+      destroyer;
+  typedef ft::vector_ops< relocator, destroyer > ops;
+
   allocator_type _alloc;
   pointer _start;
   pointer _end;
@@ -52,7 +234,7 @@ class vector {
   explicit vector(size_type n, const value_type &val = value_type(),
                   const allocator_type &alloc = allocator_type())
       : _alloc(alloc) {
-    this->_start = this->_alloc.allocate(n);
+    this->_start = this->allocate_storage(n);
     this->_end = this->_start;
     this->_end_capacity = this->_start + n;
     for (; n > 0; n--) {
@@ -70,14 +252,7 @@ class vector {
         _start(u_nullptr),
         _end(u_nullptr),
         _end_capacity(u_nullptr) {
-    difference_type n = ft::distance(first, last);
-    this->_start = this->_alloc.allocate(n);
-    this->_end_capacity = this->_start + n;
-    this->_end = this->_start;
-    for (; first != last; first++) {
-      this->_alloc.construct(this->_end, *first);
-      this->_end++;
-    }
+    range_init(first, last, ft::iterator_category(first));
   }
 
   vector(const vector &x)
@@ -86,29 +261,58 @@ class vector {
         _end(u_nullptr),
         _end_capacity(u_nullptr) {
     difference_type n = x._end - x._start;
-    this->_start = this->_alloc.allocate(n);
-    this->_end = this->_start;
-    iterator tmp_start = x._start;
-    iterator tmp_end = x._end;
-    for (; tmp_start != tmp_end; tmp_start++) {
-      this->_alloc.construct(this->_end, *tmp_start);
-      this->_end++;
+    this->_start = this->allocate_storage(n);
+    this->_end_capacity = this->_start + n;
+    try {
+      this->_end =
+          relocator::copy(this->_alloc, x._start, x._end, this->_start);
+    } catch (...) {
+      this->deallocate_storage(this->_start, n);
+      throw;
     }
-    this->_end_capacity = this->_end;
   }
 
   ~vector() {
     this->clear();
-    this->_alloc.deallocate(this->_start, this->capacity());
+    this->deallocate_storage(this->_start, this->capacity());
   }
 
   vector &operator=(const vector &x) {
     if (this != &x) {
       this->clear();
-      this->assign(x.begin(), x.end());
+      this->assign(x._start, x._end);
+    }
+    return (*this);
+  }
+
+#if __cplusplus >= 201103L
+  // buffer를 그대로 가져오고 x는 빈 vector로 남긴다.
+  vector(vector &&x) noexcept
+      : _alloc(x._alloc),
+        _start(x._start),
+        _end(x._end),
+        _end_capacity(x._end_capacity) {
+    x._start = u_nullptr;
+    x._end = u_nullptr;
+    x._end_capacity = u_nullptr;
+  }
+
+  // buffer를 반환할 allocator도 같이 가져온다. (swap과 같다)
+  vector &operator=(vector &&x) noexcept {
+    if (this != &x) {
+      this->clear();
+      this->deallocate_storage(this->_start, this->capacity());
+      this->_alloc = x._alloc;
+      this->_start = x._start;
+      this->_end = x._end;
+      this->_end_capacity = x._end_capacity;
+      x._start = u_nullptr;
+      x._end = u_nullptr;
+      x._end_capacity = u_nullptr;
     }
     return (*this);
   }
+#endif
 
   iterator begin() { return (iterator(this->_start)); }
   const_iterator begin() const { return (const_iterator(this->_start)); }
@@ -128,23 +332,17 @@ class vector {
 
   // n개의 val값들을 갖는 vector로 resize한다.
   void resize(size_type n, value_type val = value_type()) {
-    size_type prev_size = this->size();
-
     if (n > max_size()) throw(std::length_error("ft::vector::resize"));
     if (n <= this->size()) {
-      while (n < this->size()) {
-        this->_alloc.destroy(--this->_end);
-      }
+      destroyer::destroy(this->_alloc, this->_start + n, this->_end);
+      this->_end = this->_start + n;
     } else {
-      if (n <= this->capacity()) {
-        while (n > this->size()) this->push_back(val);
-      } else if (n <= this->capacity() * 2) {
-        this->reserve(this->capacity() * 2);
-        while (n-- - prev_size > 0) this->_alloc.construct(this->_end++, val);
-      } else {
-        this->reserve(n);
-        while (n-- - prev_size > 0) this->_alloc.construct(this->_end++, val);
+      if (n > this->capacity()) {
+        this->reserve(
+            recommend_capacity(n - this->size(), "ft::vector::resize"));
       }
+      this->_end =
+          relocator::fill(this->_alloc, this->_end, n - this->size(), val);
     }
   }
 
@@ -158,23 +356,39 @@ class vector {
       return (false);
   }
 
+  /**
+   * 새 buffer에 element를 먼저 다 만든 뒤에 기존 element를 destroy 하고
+   * buffer를 반환한다. 만드는 중에 예외가 나면 새 buffer만 정리하므로
+   * vector는 reserve 전 그대로다. (strong guarantee)
+   */
   void reserve(size_type n) {
     if (n > max_size()) {
       throw(std::length_error("ft::vector::reserve"));
     }
     if (n > this->capacity()) {
-      pointer prev_start = this->_start;
-      pointer prev_end = this->_end;
-      pointer prev_end_capacity = this->_end_capacity;
-
-      this->_start = this->_alloc.allocate(n);
-      this->_end_capacity = this->_start + n;
-      this->_end = this->_start;
-      for (pointer tmp = prev_start; tmp != prev_end; tmp++) {
-        this->_alloc.construct(this->_end++, *tmp);
-        this->_alloc.destroy(tmp);
+      pointer new_start = this->allocate_storage(n);
+      pointer new_end;
+
+      try {
+        new_end =
+            relocator::move(this->_alloc, this->_start, this->_end, new_start);
+      } catch (...) {
+        this->deallocate_storage(new_start, n);
+        throw;
       }
-      this->_alloc.deallocate(prev_start, prev_end_capacity - prev_start);
+      destroyer::destroy(this->_alloc, this->_start, this->_end);
+      this->deallocate_storage(this->_start, this->capacity());
+      this->_start = new_start;
+      this->_end = new_end;
+      this->_end_capacity = new_start + n;
+    }
+  }
+
+  // capacity를 size에 맞춘다. (남는 capacity가 없으면 아무것도 안 함)
+  void shrink_to_fit() {
+    if (this->_end != this->_end_capacity) {
+      vector tmp(*this);
+      this->swap(tmp);
     }
   }
 
@@ -209,25 +423,7 @@ class vector {
   void assign(InputIterator first, InputIterator last,
               typename ft::enable_if< !ft::is_integral< InputIterator >::value,
                                       InputIterator >::type * = u_nullptr) {
-    this->clear();
-    size_type _size = ft::distance(first, last);
-    if (this->capacity() >= _size) {
-      while (first != last) {
-        this->_alloc.construct(this->_end++, *first);
-        first++;
-      }
-    } else {
-      pointer prev_start = this->_start;
-      pointer prev_end_capacity = this->_end_capacity;
-
-      this->_start = this->_alloc.allocate(_size);
-      this->_end_capacity = this->_start + _size;
-      this->_end = this->_start;
-      for (const_pointer tmp = &(*first); tmp != &(*last); tmp++) {
-        this->_alloc.construct(this->_end++, *tmp);
-      }
-      this->_alloc.deallocate(prev_start, prev_end_capacity - prev_start);
-    }
+    assign_range(first, last, ft::iterator_category(first));
   }
 
   void assign(size_type n, const value_type &val) {
@@ -240,50 +436,90 @@ class vector {
       pointer prev_start = this->_start;
       pointer prev_end_capacity = this->_end_capacity;
 
-      this->_start = this->_alloc.allocate(n);
+      this->_start = this->allocate_storage(n);
       this->_end_capacity = this->_start + n;
       this->_end = this->_start;
       while (n--) {
         this->_alloc.construct(this->_end++, val);
       }
-      this->_alloc.deallocate(prev_start, prev_end_capacity - prev_start);
+      this->deallocate_storage(prev_start, prev_end_capacity - prev_start);
     }
   }
 
   // 벡터의 뒤에 새로운 element를 추가한다.
-  // 늘어난 벡터의 크기가 capacity를 넘어갈 경우, 이전 capacity * 2의 크기로
-  // 늘어남.
+  // 늘어난 벡터의 크기가 capacity를 넘어갈 경우, Growth에 따라 늘어남.
   void push_back(const value_type &val) {
     if (this->_end == this->_end_capacity) {
-      if (this->_start == this->_end)
-        this->reserve(1);
-      else
-        this->reserve(this->capacity() * 2);
+      // val이 이 vector의 element일 수도 있으므로 reserve로 먼저 옮기지 않고
+      // 새 buffer에 val부터 만드는 insert로 처리한다.
+      this->insert(this->end(), 1, val);
+      return;
     }
     this->_alloc.construct(this->_end, val);
     ++this->_end;
   }
 
+#if __cplusplus >= 201103L
+  void push_back(value_type &&val) { this->emplace_back(std::move(val)); }
+
+  // args로 맨 뒤에 바로 construct 한다. 공간이 없으면 새 buffer에 새 element를
+  // 먼저 만든 뒤 기존 element를 옮긴다. (args가 element를 가리켜도 안전)
+  template < typename... Args >
+  void emplace_back(Args &&...args) {
+    if (this->_end != this->_end_capacity) {
+      std::allocator_traits< allocator_type >::construct(
+          this->_alloc, this->_end, std::forward< Args >(args)...);
+      ++this->_end;
+      return;
+    }
+    size_type len = recommend_capacity(1, "ft::vector::emplace_back");
+    pointer new_start = this->allocate_storage(len);
+    pointer new_end = new_start + this->size();
+
+    try {
+      std::allocator_traits< allocator_type >::construct(
+          this->_alloc, new_end, std::forward< Args >(args)...);
+    } catch (...) {
+      this->deallocate_storage(new_start, len);
+      throw;
+    }
+    reallocate_around(this->_end, new_start, new_end + 1, len);
+  }
+#endif
+
   // 벡터의 맨 뒤 요소를 하나 제거한다.
   void pop_back() { this->_alloc.destroy(--this->_end); }
 
   iterator insert(iterator position, const value_type &val) {
-    size_type position_idx = &(*position) - this->_start;
+    size_type position_idx = position.base() - this->_start;
     this->insert(position, 1, val);
     return (this->begin() + position_idx);
   }
 
+  /**
+   * position 앞에 val을 n개 넣는다.
+   * capacity가 충분하면 뒤쪽을 밀어 gap을 만들고(vector_ops::fill_insert),
+   * 모자라면 새 buffer에 [앞부분, 새 element, 뒷부분]을 한 번에 옮긴다.
+   */
   void insert(iterator position, size_type n, const value_type &val) {
-    size_type mv_back_count = this->_end - &(*position);
+    if (n == 0) return;
+    pointer pos = position.base();
 
-    this->resize(this->size() + n);
-    pointer tmp = this->_end - 1;
-    for (; mv_back_count > 0; mv_back_count--, tmp--) {
-      this->_alloc.construct(tmp, *(tmp - n));
-      this->_alloc.destroy(tmp - n);
-    }
-    while (n--) {
-      this->_alloc.construct(tmp--, val);
+    if (size_type(this->_end_capacity - this->_end) >= n) {
+      this->_end = ops::fill_insert(this->_alloc, pos, this->_end, n, val);
+    } else {
+      size_type len = recommend_capacity(n, "ft::vector::insert");
+      pointer new_start = this->allocate_storage(len);
+      pointer new_end = new_start + (pos - this->_start);
+
+      try {
+        relocator::fill(this->_alloc, new_end, n, val);
+      } catch (...) {
+        this->deallocate_storage(new_start, len);
+        throw;
+      }
+      new_end += n;
+      reallocate_around(pos, new_start, new_end, len);
     }
   }
 
@@ -292,50 +528,18 @@ class vector {
       iterator position, InputIterator first, InputIterator last,
       typename ft::enable_if< !ft::is_integral< InputIterator >::value >::type
           * = u_nullptr) {
-    size_type n = ft::distance(first, last);
-    size_type mv_back_count = this->_end - &(*position);
-    this->resize(this->size() + n);
-    pointer tmp = this->_end - 1;
-    for (; mv_back_count > 0; mv_back_count--, tmp--) {
-      this->_alloc.construct(tmp, *(tmp - n));
-      this->_alloc.destroy(tmp - n);
-    }
-    while (first != last) {
-      this->_alloc.construct(tmp--, *(--last));
-    }
+    insert_range(position.base(), first, last, ft::iterator_category(first));
   }
 
-  iterator erase(iterator position) {
-    pointer location = (&(*position));
-
-    this->_alloc.destroy(&(*position));
-    --this->_end;
-    for (pointer ptr = &(*position); ptr != this->_end; ptr++) {
-      this->_alloc.construct(ptr, *(ptr + 1));
-      this->_alloc.destroy(ptr + 1);
-    }
-    return (iterator(location));
-  }
+  iterator erase(iterator position) { return (erase(position, position + 1)); }
 
   iterator erase(iterator first, iterator last) {
-    pointer location = &(*first);
-    pointer f_ptr = &(*first), l_ptr = &(*last);
-    size_type erase_size = l_ptr - f_ptr;
-
-    for (; f_ptr != l_ptr; f_ptr++) {
-      this->_alloc.destroy(f_ptr);
-    }
-    for (f_ptr = &(*first); l_ptr != this->_end; f_ptr++, l_ptr++) {
-      this->_alloc.construct(f_ptr, *l_ptr);
-      this->_alloc.destroy(l_ptr);
-    }
-    this->_end -= erase_size;
-    return (iterator(location));
+    this->_end =
+        ops::erase(this->_alloc, first.base(), last.base(), this->_end);
+    return (first);
   }
 
   void swap(vector &x) {
-    if (*this == x) return;
-
     pointer tmp_start = x._start;
     pointer tmp_end = x._end;
     pointer tmp_end_capacity = x._end_capacity;
@@ -353,55 +557,155 @@ class vector {
   }
 
   void clear() {
-    while (this->_end != this->_start) {
-      this->_alloc.destroy(--this->_end);
-    }
+    destroyer::destroy(this->_alloc, this->_start, this->_end);
+    this->_end = this->_start;
   }
 
   allocator_type get_allocator() const { return (this->_alloc); }
-};
 
-template < typename T, typename Alloc >
-bool operator==(const vector< T, Alloc > &lhs, const vector< T, Alloc > &rhs) {
-  if (lhs.size() != rhs.size()) return (false);
+ private:
+  // 0개짜리 buffer는 allocator를 거치지 않고 null로 둔다.
+  // (빈 vector의 복사, 소멸에서 allocate(0) / deallocate(null)을 부르지 않음)
+  pointer allocate_storage(size_type n) {
+    return (n ? this->_alloc.allocate(n) : u_nullptr);
+  }
 
-  typename ft::vector< T, Alloc >::const_iterator it_lhs = lhs.begin();
-  typename ft::vector< T, Alloc >::const_iterator it_rhs = rhs.begin();
+  void deallocate_storage(pointer p, size_type n) {
+    if (p != u_nullptr) {
+      this->_alloc.deallocate(p, n);
+    }
+  }
 
-  for (; it_lhs != lhs.end(); it_lhs++, it_rhs++) {
-    if (it_rhs == rhs.end() || *it_lhs != *it_rhs) return (false);
+  // n개를 더 넣을 때 새로 잡을 capacity. (Growth가 정한다)
+  size_type recommend_capacity(size_type n, const char *what) const {
+    if (this->max_size() - this->size() < n) {
+      throw(std::length_error(what));
+    }
+    return (Growth::next_capacity(this->capacity(), this->size() + n,
+                                  sizeof(value_type), this->max_size()));
   }
-  return (true);
-}
 
-template < typename T, typename Alloc >
-bool operator!=(const vector< T, Alloc > &lhs, const vector< T, Alloc > &rhs) {
-  return (!(lhs == rhs));
-}
+  // 기존 element를 새 buffer의 새 element 양옆으로 옮긴 뒤 기존 buffer를
+  // 반환한다. 옮기다 예외가 나면 새 buffer만 정리하고 기존 buffer는 그대로.
+  void reallocate_around(pointer pos, pointer new_start, pointer new_end,
+                         size_type len) {
+    pointer finish;
+
+    try {
+      finish = ops::copy_around(this->_alloc, this->_start, pos, this->_end,
+                                new_start, new_end);
+    } catch (...) {
+      this->deallocate_storage(new_start, len);
+      throw;
+    }
+    destroyer::destroy(this->_alloc, this->_start, this->_end);
+    this->deallocate_storage(this->_start, this->capacity());
+    this->_start = new_start;
+    this->_end = finish;
+    this->_end_capacity = new_start + len;
+  }
 
-template < typename T, typename Alloc >
-bool operator<(const vector< T, Alloc > &lhs, const vector< T, Alloc > &rhs) {
-  return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(),
-                                      rhs.end()));
-}
+  // input iterator는 한 번만 읽을 수 있으므로 개수를 세지 않고 하나씩 넣는다.
+  template < typename InputIterator >
+  void range_init(InputIterator first, InputIterator last,
+                  ft::input_iterator_tag) {
+    try {
+      for (; first != last; ++first) {
+        this->push_back(*first);
+      }
+    } catch (...) {
+      this->clear();
+      this->deallocate_storage(this->_start, this->capacity());
+      throw;
+    }
+  }
 
-template < typename T, typename Alloc >
-bool operator<=(const vector< T, Alloc > &lhs, const vector< T, Alloc > &rhs) {
-  return (!(rhs < lhs));
-}
+  template < typename ForwardIterator >
+  void range_init(ForwardIterator first, ForwardIterator last,
+                  ft::forward_iterator_tag) {
+    size_type n = ft::distance(first, last);
 
-template < typename T, typename Alloc >
-bool operator>(const vector< T, Alloc > &lhs, const vector< T, Alloc > &rhs) {
-  return (rhs < lhs);
-}
+    this->_start = this->allocate_storage(n);
+    this->_end_capacity = this->_start + n;
+    try {
+      this->_end = relocator::copy(this->_alloc, first, last, this->_start);
+    } catch (...) {
+      this->deallocate_storage(this->_start, n);
+      throw;
+    }
+  }
 
-template < typename T, typename Alloc >
-bool operator>=(const vector< T, Alloc > &lhs, const vector< T, Alloc > &rhs) {
-  return (!(lhs < rhs));
-}
+  template < typename InputIterator >
+  void assign_range(InputIterator first, InputIterator last,
+                    ft::input_iterator_tag) {
+    this->clear();
+    for (; first != last; ++first) {
+      this->push_back(*first);
+    }
+  }
+
+  template < typename ForwardIterator >
+  void assign_range(ForwardIterator first, ForwardIterator last,
+                    ft::forward_iterator_tag) {
+    this->clear();
+    size_type _size = ft::distance(first, last);
+    if (this->capacity() >= _size) {
+      this->_end = relocator::copy(this->_alloc, first, last, this->_start);
+    } else {
+      pointer prev_start = this->_start;
+      pointer prev_end_capacity = this->_end_capacity;
+
+      this->_start = this->allocate_storage(_size);
+      this->_end_capacity = this->_start + _size;
+      this->_end = this->_start;
+      this->deallocate_storage(prev_start, prev_end_capacity - prev_start);
+      this->_end = relocator::copy(this->_alloc, first, last, this->_start);
+    }
+  }
+
+  template < typename InputIterator >
+  void insert_range(pointer pos, InputIterator first, InputIterator last,
+                    ft::input_iterator_tag) {
+    size_type idx = pos - this->_start;
+
+    for (; first != last; ++first, ++idx) {
+      this->insert(this->begin() + idx, *first);
+    }
+  }
+
+  // 개수를 먼저 알 수 있으므로 insert(position, n, val)과 같은 방식.
+  template < typename ForwardIterator >
+  void insert_range(pointer pos, ForwardIterator first, ForwardIterator last,
+                    ft::forward_iterator_tag) {
+    size_type n = ft::distance(first, last);
+    if (n == 0) return;
+
+    if (size_type(this->_end_capacity - this->_end) >= n) {
+      this->_end =
+          ops::range_insert(this->_alloc, pos, this->_end, first, last, n);
+    } else {
+      size_type len = recommend_capacity(n, "ft::vector::insert");
+      pointer new_start = this->allocate_storage(len);
+      pointer new_end = new_start + (pos - this->_start);
+
+      try {
+        new_end = relocator::copy(this->_alloc, first, last, new_end);
+      } catch (...) {
+        this->deallocate_storage(new_start, len);
+        throw;
+      }
+      reallocate_around(pos, new_start, new_end, len);
+    }
+  }
+};
+
+template < typename T, typename Alloc, typename Growth >
+struct is_vector_like< vector< T, Alloc, Growth > > {
+  static const bool value = true;
+};
 
-template < typename T, typename Alloc >
-void swap(vector< T, Alloc > &x, vector< T, Alloc > &y) {
+template < typename T, typename Alloc, typename Growth >
+void swap(vector< T, Alloc, Growth > &x, vector< T, Alloc, Growth > &y) {
   x.swap(y);
 }
 
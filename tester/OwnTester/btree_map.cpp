@@ -0,0 +1,232 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "btree_map.hpp"
+
+#include <iostream>
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+// std에는 btree_map이 없으므로 std::map의 출력과 비교한다.
+#define IS_STD_std 1
+#define IS_STD_ft 0
+#define CAT(a, b) a##b
+#define XCAT(a, b) CAT(a, b)
+
+#define T1 int
+#define T2 std::string
+
+// small_map은 노드가 작아서 element 몇백 개로도 split / merge가 여러 단계
+// 일어난다.
+#if XCAT(IS_STD_, TESTED_NAMESPACE)
+#define TESTED_MAP std::map< T1, T2 >
+typedef std::map< int, int > small_map;
+#else
+#define TESTED_MAP ft::btree_map< T1, T2 >
+typedef ft::btree_map< int, int, ft::less< int >,
+                       std::allocator< ft::pair< const int, int > >, 64 >
+    small_map;
+#endif
+
+#define T3 TESTED_MAP::value_type
+
+template < typename T_MAP >
+void printContainers(T_MAP const &mp, bool print_content = true) {
+  std::cout << "size: " << mp.size() << std::endl;
+  if (print_content) {
+    typename T_MAP::const_iterator it = mp.begin();
+    typename T_MAP::const_iterator ite = mp.end();
+    std::cout << "Content is:" << std::endl;
+    for (; it != ite; ++it) {
+      std::cout << "- KEY: " << (*it).first << "\t|\t VALUE: " << (*it).second
+                << std::endl;
+    }
+  }
+  std::cout << "###############################################" << std::endl;
+}
+
+int main() {
+  std::cout << "////////// TEST BTREE_MAP //////////" << std::endl;
+
+  std::cout << "  == default / range / copy constructor test ==" << std::endl;
+  TESTED_MAP mp;
+  printContainers(mp);
+
+  std::list< T3 > lst;
+  for (unsigned int i = 0; i < 10; ++i) {
+    lst.push_back(T3(10 - i, std::string(i + 1, i + 65)));
+  }
+  TESTED_MAP mp_range(lst.begin(), lst.end());
+  printContainers(mp_range);
+
+  TESTED_MAP mp_copy(mp_range);
+  printContainers(mp_copy);
+
+  TESTED_MAP mp_from_self(mp_range.begin(), mp_range.end());
+  printContainers(mp_from_self);
+
+  std::cout << "  == size / clear / empty test ==" << std::endl;
+  mp_copy.clear();
+  printContainers(mp_copy);
+  std::cout << "Is empty: " << (mp_copy.empty() ? "OK" : "KO") << std::endl;
+
+  std::cout << "  == insert / erase / [] test ==" << std::endl;
+  std::cout << "insert 5: " << mp_copy.insert(T3(5, "five")).second
+            << std::endl;
+  std::cout << "insert 5 again: " << mp_copy.insert(T3(5, "FIVE")).second
+            << std::endl;
+  mp_copy.insert(mp_copy.end(), T3(9, "nine"));
+  mp_copy.insert(mp_copy.begin(), T3(1, "one"));
+  mp_copy.insert(mp_copy.end(), T3(3, "wrong hint"));
+  mp_copy.insert(++mp_copy.begin(), T3(9, "dup"));
+  printContainers(mp_copy);
+
+  mp_copy[7] = "seven";
+  mp_copy[1] = "ONE";
+  std::cout << "operator[] missing: [" << mp_copy[4] << "]" << std::endl;
+  mp_copy.begin()->second = "first";
+  printContainers(mp_copy);
+
+  mp_copy.erase(++mp_copy.begin());
+  std::cout << "erase 7: " << mp_copy.erase(7) << std::endl;
+  std::cout << "erase 42: " << mp_copy.erase(42) << std::endl;
+  printContainers(mp_copy);
+  mp_copy.erase(++mp_copy.begin(), --mp_copy.end());
+  printContainers(mp_copy);
+
+  std::cout << "  == bulk insert test ==" << std::endl;
+  {
+    std::list< T3 > unsorted;
+    for (unsigned int i = 0; i < 20; ++i) {
+      unsorted.push_back(T3((i * 7) % 13, std::string(i % 5 + 1, i + 65)));
+    }
+    TESTED_MAP bulk;
+    bulk[3] = "kept";
+    bulk[100] = "end";
+    bulk.insert(unsorted.begin(), unsorted.end());
+    printContainers(bulk);
+
+    std::list< T3 > tail;
+    for (unsigned int i = 0; i < 5; ++i) {
+      tail.push_back(T3(200 + i, "tail"));
+    }
+    bulk.insert(tail.begin(), tail.end());
+    bulk.insert(tail.begin(), tail.begin());
+    printContainers(bulk);
+  }
+
+  std::cout << "  == swap / find / count test ==" << std::endl;
+  swap(mp_copy, mp_range);
+  printContainers(mp_copy);
+  printContainers(mp_range);
+  std::cout << "find 5: " << mp_copy.find(5)->second << std::endl;
+  std::cout << "find 42 is end: " << (mp_copy.find(42) == mp_copy.end())
+            << std::endl;
+  std::cout << "count 5: " << mp_copy.count(5) << std::endl;
+  std::cout << "count 20: " << mp_copy.count(20) << std::endl;
+
+  std::cout << "  == lower & upper_bound / equal_range test ==" << std::endl;
+  std::cout << "lower_bound " << mp_copy.lower_bound(5)->first << std::endl;
+  std::cout << "upper_bound " << mp_copy.upper_bound(5)->first << std::endl;
+  std::cout << "equal_range " << mp_copy.equal_range(5).first->first << ", "
+            << mp_copy.equal_range(5).second->first << std::endl;
+  std::cout << "upper_bound 10 is end: "
+            << (mp_copy.upper_bound(10) == mp_copy.end()) << std::endl;
+
+  std::cout << "  == iterator test ==" << std::endl;
+  {
+    const TESTED_MAP &cref = mp_copy;
+    TESTED_MAP::const_iterator cit = mp_copy.begin();
+    std::cout << "const == iterator: " << (cit == mp_copy.begin())
+              << std::endl;
+    for (TESTED_MAP::const_reverse_iterator rit = cref.rbegin();
+         rit != cref.rend(); ++rit) {
+      std::cout << rit->first << ":" << (*rit).second << " ";
+    }
+    std::cout << std::endl;
+    T3 copied = *mp_copy.find(3);
+    std::cout << "copied pair: " << copied.first << " " << copied.second
+              << std::endl;
+  }
+
+  std::cout << "  == split / merge test ==" << std::endl;
+  {
+    small_map big;
+    for (int i = 0; i < 500; ++i) {
+      big[(i * 37) % 500] = i;
+    }
+    for (int i = 0; i < 500; i += 3) {
+      big.erase(i);
+    }
+    big.erase(big.lower_bound(100), big.upper_bound(300));
+    for (int i = 1000; i < 1100; ++i) {
+      big.insert(big.end(), small_map::value_type(i, -i));
+    }
+    small_map big_copy(big);
+    big.erase(big.begin(), big.lower_bound(450));
+    std::cout << "size: " << big.size() << " " << big_copy.size() << std::endl;
+    long sum = 0;
+    for (small_map::const_iterator it = big_copy.begin();
+         it != big_copy.end(); ++it) {
+      sum += it->first * 3 + it->second;
+    }
+    std::cout << "sum: " << sum << std::endl;
+    for (small_map::reverse_iterator rit = big.rbegin(); rit != big.rend();
+         ++rit) {
+      std::cout << rit->first << " ";
+    }
+    std::cout << std::endl;
+    while (!big_copy.empty()) {
+      big_copy.erase(big_copy.begin());
+    }
+    std::cout << "drained: " << big_copy.empty() << " "
+              << (big_copy.begin() == big_copy.end()) << std::endl;
+  }
+
+  std::cout << "  == relational operators test ==" << std::endl;
+  TESTED_MAP lhs(mp_copy);
+  TESTED_MAP rhs(mp_copy);
+  std::cout << (lhs == rhs) << (lhs != rhs) << (lhs < rhs) << (lhs <= rhs)
+            << (lhs > rhs) << (lhs >= rhs) << std::endl;
+  lhs[5] = "Hello";
+  std::cout << (lhs == rhs) << (lhs != rhs) << (lhs < rhs) << (lhs <= rhs)
+            << (lhs > rhs) << (lhs >= rhs) << std::endl;
+  rhs.erase(1);
+  std::cout << (lhs == rhs) << (lhs != rhs) << (lhs < rhs) << (lhs <= rhs)
+            << (lhs > rhs) << (lhs >= rhs) << std::endl;
+
+#if __cplusplus >= 201103L
+  std::cout << "  == move / emplace test (C++11) ==" << std::endl;
+  {
+    TESTED_MAP mp_src;
+    std::cout << "emplace: " << mp_src.emplace(3, "three").second << std::endl;
+    std::cout << "emplace dup: " << mp_src.emplace(3, "again").second
+              << std::endl;
+    mp_src.emplace_hint(mp_src.end(), 9, "nine");
+    mp_src.emplace(4, std::string(4, 'f'));
+    printContainers(mp_src);
+
+    TESTED_MAP mp_moved(std::move(mp_src));
+    std::cout << "moved-from size: " << mp_src.size() << std::endl;
+    TESTED_MAP mp_assigned;
+    mp_assigned[100] = "old";
+    mp_assigned = std::move(mp_moved);
+    printContainers(mp_assigned);
+  }
+#endif
+}
@@ -0,0 +1,202 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_set.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "btree_set.hpp"
+
+#include <iostream>
+#include <list>
+#include <set>
+#include <string>
+#include <utility>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+// std에는 btree_set이 없으므로 std::set의 출력과 비교한다.
+#define IS_STD_std 1
+#define IS_STD_ft 0
+#define CAT(a, b) a##b
+#define XCAT(a, b) CAT(a, b)
+
+#define T1 int
+
+// small_set은 노드가 작아서 element 몇백 개로도 split / merge가 여러 단계
+// 일어난다.
+#if XCAT(IS_STD_, TESTED_NAMESPACE)
+#define BTREE_SET(T, C) std::set< T, C >
+typedef std::set< int > small_set;
+#else
+#define BTREE_SET(T, C) ft::btree_set< T, C >
+typedef ft::btree_set< int, ft::less< int >, std::allocator< int >, 32 >
+    small_set;
+#endif
+
+// 상태를 갖는 comparator. (reverse가 true면 내림차순)
+struct order_less {
+  bool reverse;
+  order_less(bool r = false) : reverse(r) {}
+  bool operator()(const T1 &x, const T1 &y) const {
+    return (reverse ? y < x : x < y);
+  }
+};
+
+#define TESTED_SET BTREE_SET(T1, TESTED_NAMESPACE::less< T1 >)
+
+template < typename T_SET >
+void printContainers(T_SET const &st, bool print_content = true) {
+  std::cout << "size: " << st.size() << std::endl;
+  if (print_content) {
+    typename T_SET::const_iterator it = st.begin();
+    typename T_SET::const_iterator ite = st.end();
+    std::cout << "Content is:" << std::endl;
+    for (; it != ite; ++it) {
+      std::cout << "- " << *it << std::endl;
+    }
+  }
+  std::cout << "###############################################" << std::endl;
+}
+
+int main() {
+  std::cout << "////////// TEST BTREE_SET //////////" << std::endl;
+
+  std::cout << "  == default / range / copy constructor test ==" << std::endl;
+  TESTED_SET st;
+  printContainers(st);
+
+  std::list< T1 > lst;
+  for (unsigned int i = 0; i < 10; ++i) {
+    lst.push_back((i * 7) % 10);
+  }
+  TESTED_SET st_range(lst.begin(), lst.end());
+  printContainers(st_range);
+
+  TESTED_SET st_copy(st_range);
+  printContainers(st_copy);
+
+  std::cout << "  == size / clear / empty test ==" << std::endl;
+  st_copy.clear();
+  printContainers(st_copy);
+  std::cout << "Is empty: " << (st_copy.empty() ? "OK" : "KO") << std::endl;
+
+  std::cout << "  == insert / erase test ==" << std::endl;
+  std::cout << "insert 5: " << st_copy.insert(5).second << std::endl;
+  std::cout << "insert 5 again: " << st_copy.insert(5).second << std::endl;
+  st_copy.insert(st_copy.end(), 9);
+  st_copy.insert(st_copy.begin(), 1);
+  st_copy.insert(st_copy.end(), 3);
+  st_copy.insert(++st_copy.begin(), 9);
+  printContainers(st_copy);
+
+  st_copy.erase(++st_copy.begin());
+  std::cout << "erase 9: " << st_copy.erase(9) << std::endl;
+  std::cout << "erase 42: " << st_copy.erase(42) << std::endl;
+  printContainers(st_copy);
+
+  std::cout << "  == bulk insert test ==" << std::endl;
+  {
+    std::list< T1 > unsorted;
+    for (unsigned int i = 0; i < 20; ++i) {
+      unsorted.push_back((i * 7) % 13);
+    }
+    TESTED_SET bulk;
+    bulk.insert(100);
+    bulk.insert(unsorted.begin(), unsorted.end());
+    printContainers(bulk);
+    bulk.insert(st_range.begin(), st_range.end());
+    bulk.erase(bulk.lower_bound(4), bulk.upper_bound(8));
+    printContainers(bulk);
+  }
+
+  std::cout << "  == swap / find / count test ==" << std::endl;
+  swap(st_copy, st_range);
+  printContainers(st_copy);
+  printContainers(st_range);
+  std::cout << "find 5: " << *st_copy.find(5) << std::endl;
+  std::cout << "find 42 is end: " << (st_copy.find(42) == st_copy.end())
+            << std::endl;
+  std::cout << "count 5: " << st_copy.count(5) << std::endl;
+  std::cout << "count 20: " << st_copy.count(20) << std::endl;
+
+  std::cout << "  == lower & upper_bound / equal_range test ==" << std::endl;
+  std::cout << "lower_bound " << *st_copy.lower_bound(5) << std::endl;
+  std::cout << "upper_bound " << *st_copy.upper_bound(5) << std::endl;
+  std::cout << "equal_range " << *st_copy.equal_range(5).first << ", "
+            << *st_copy.equal_range(5).second << std::endl;
+  for (TESTED_SET::const_reverse_iterator rit = st_copy.rbegin();
+       rit != st_copy.rend(); ++rit) {
+    std::cout << *rit << " ";
+  }
+  std::cout << std::endl;
+
+  std::cout << "  == split / merge test ==" << std::endl;
+  {
+    small_set big;
+    for (int i = 0; i < 500; ++i) {
+      big.insert((i * 37) % 500);
+    }
+    for (int i = 0; i < 500; i += 3) {
+      big.erase(i);
+    }
+    big.erase(big.lower_bound(100), big.upper_bound(300));
+    small_set big_copy(big);
+    big.erase(big.begin(), big.lower_bound(450));
+    std::cout << "size: " << big.size() << " " << big_copy.size() << std::endl;
+    long sum = 0;
+    for (small_set::const_iterator it = big_copy.begin();
+         it != big_copy.end(); ++it) {
+      sum += *it;
+    }
+    std::cout << "sum: " << sum << std::endl;
+    for (small_set::reverse_iterator rit = big.rbegin(); rit != big.rend();
+         ++rit) {
+      std::cout << *rit << " ";
+    }
+    std::cout << std::endl;
+    while (!big_copy.empty()) {
+      big_copy.erase(--big_copy.end());
+    }
+    std::cout << "drained: " << big_copy.empty() << std::endl;
+  }
+
+  std::cout << "  == relational operators test ==" << std::endl;
+  TESTED_SET lhs(st_copy);
+  TESTED_SET rhs(st_copy);
+  std::cout << (lhs == rhs) << (lhs != rhs) << (lhs < rhs) << (lhs <= rhs)
+            << (lhs > rhs) << (lhs >= rhs) << std::endl;
+  lhs.insert(-1);
+  std::cout << (lhs == rhs) << (lhs != rhs) << (lhs < rhs) << (lhs <= rhs)
+            << (lhs > rhs) << (lhs >= rhs) << std::endl;
+
+  std::cout << "  == custom compare test ==" << std::endl;
+  {
+    typedef BTREE_SET(T1, order_less) custom_set;
+    custom_set cmp(lst.begin(), lst.end(), order_less(true));
+    cmp.insert(42);
+    printContainers(cmp);
+    std::cout << "lower_bound 3: " << *cmp.lower_bound(3) << std::endl;
+    std::cout << "key_comp reverse: " << cmp.key_comp().reverse << std::endl;
+  }
+
+#if __cplusplus >= 201103L
+  std::cout << "  == move / emplace test (C++11) ==" << std::endl;
+  {
+    TESTED_SET st_src;
+    std::cout << "emplace: " << st_src.emplace(3).second << std::endl;
+    std::cout << "emplace dup: " << st_src.emplace(3).second << std::endl;
+    st_src.emplace_hint(st_src.end(), 9);
+    TESTED_SET st_moved(std::move(st_src));
+    std::cout << "moved-from size: " << st_src.size() << std::endl;
+    printContainers(st_moved);
+  }
+#endif
+}
@@ -10,12 +10,22 @@
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "counting_allocator.hpp"
 #include "map.hpp"
+#include "pool_allocator.hpp"
+#include "vector.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 #include <list>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 201103L
+#include <type_traits>
+#endif
 
 #ifndef TESTED_NAMESPACE
 #define TESTED_NAMESPACE ft
@@ -26,14 +36,147 @@
 #define T3 TESTED_NAMESPACE::map< T1, T2 >::value_type
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::map< T1, T2 >::size_type
 
+// std::map에는 nth, rank가 없으므로 같은 결과를 선형으로 구해서 비교한다.
+#define IS_STD_std 1
+#define IS_STD_ft 0
+#define CAT(a, b) a##b
+#define XCAT(a, b) CAT(a, b)
+
+#if XCAT(IS_STD_, TESTED_NAMESPACE)
+typedef std::map< T1, T2 > ranked_map;
+
+ranked_map::const_iterator nth(const ranked_map &mp, size_t k) {
+  ranked_map::const_iterator it = mp.begin();
+  std::advance(it, std::min(k, mp.size()));
+  return (it);
+}
+size_t rank(const ranked_map &mp, const T1 &key) {
+  return (std::distance(mp.begin(), mp.lower_bound(key)));
+}
+#define RANKED_DISTANCE std::distance
+
+// frozen_map 대신 같은 내용의 std::map 복사본.
+typedef std::map< T1, T2 > frozen_map_type;
+frozen_map_type freeze(const std::map< T1, T2 > &mp) { return (mp); }
+
+// std::less<void>는 C++14부터 있으므로 probe의 key를 직접 넘긴다.
+typedef std::map< T1, T2 > transparent_map;
+#define TRANSPARENT_KEY(x) (x).key
+
+// std::map::try_emplace는 C++17부터 있으므로 insert로 대신한다.
+// insert는 value_type을 따로 만들므로 복사 횟수는 비교하지 않는다.
+template < typename M, typename V >
+std::pair< typename M::iterator, bool > try_emplace(
+    M &mp, const typename M::key_type &k, const V &v) {
+  return (mp.insert(typename M::value_type(k, v)));
+}
+#define TRY_EMPLACE(mp, k, v) try_emplace(mp, k, v)
+#define COPIED_ONCE(n) true
+
+// key만 받는 try_emplace. 없을 때만 mapped_type()을 만든다.
+template < typename M >
+std::pair< typename M::iterator, bool > try_emplace_key(
+    M &mp, const typename M::key_type &k) {
+  typename M::iterator it = mp.lower_bound(k);
+
+  if (it != mp.end() && !mp.key_comp()(k, it->first)) {
+    return (std::make_pair(it, false));
+  }
+  return (std::make_pair(
+      mp.insert(it, typename M::value_type(k, typename M::mapped_type())),
+      true));
+}
+#define TRY_EMPLACE_KEY(mp, k) try_emplace_key(mp, k)
+#else
+typedef ft::map< T1, T2, ft::less< T1 >, std::allocator< T3 >, true >
+    ranked_map;
+
+ranked_map::const_iterator nth(const ranked_map &mp, size_t k) {
+  return (mp.nth(k));
+}
+size_t rank(const ranked_map &mp, const T1 &key) { return (mp.rank(key)); }
+#define RANKED_DISTANCE ft::distance
+
+typedef ft::map< T1, T2 >::frozen_type frozen_map_type;
+frozen_map_type freeze(const ft::map< T1, T2 > &mp) { return (mp.freeze()); }
+
+typedef ft::map< T1, T2, ft::less< void > > transparent_map;
+#define TRANSPARENT_KEY(x) (x)
+
+#define TRY_EMPLACE(mp, k, v) mp.try_emplace(k, v)
+#define TRY_EMPLACE_KEY(mp, k) mp.try_emplace(k)
+#define COPIED_ONCE(n) ((n) == 1)
+#endif
+
+// 상태를 갖는 comparator. (reverse가 true면 내림차순)
+struct order_less {
+  bool reverse;
+  order_less(bool r = false) : reverse(r) {}
+  bool operator()(const T1 &x, const T1 &y) const {
+    return (reverse ? y < x : x < y);
+  }
+};
+
+// 상태(id)를 갖는 allocator.
+template < typename T >
+struct tagged_allocator : public std::allocator< T > {
+  int id;
+  template < typename U >
+  struct rebind {
+    typedef tagged_allocator< U > other;
+  };
+  tagged_allocator(int i = 0) : std::allocator< T >(), id(i) {}
+  template < typename U >
+  tagged_allocator(const tagged_allocator< U > &ot)
+      : std::allocator< T >(), id(ot.id) {}
+};
+
+// 복사 생성될 때마다 센다. (move는 세지 않는다)
+// defaults는 기본 생성된 횟수.
+struct copy_counter {
+  static int copies;
+  static int defaults;
+  int val;
+  copy_counter() : val(0) { ++defaults; }
+  copy_counter(int v) : val(v) {}
+  copy_counter(const copy_counter &ot) : val(ot.val) { ++copies; }
+#if __cplusplus >= 201103L
+  copy_counter(copy_counter &&ot) : val(ot.val) {}
+#endif
+  copy_counter &operator=(const copy_counter &ot) {
+    this->val = ot.val;
+    return (*this);
+  }
+};
+int copy_counter::copies = 0;
+int copy_counter::defaults = 0;
+
+/**
+ * key_type이 아닌 탐색용 type. key_type으로 바뀔 때마다 conversions를
+ * 센다. transparent comparator면 바뀌지 않고 그대로 비교되어야 한다.
+ */
+struct probe {
+  static int conversions;
+  T1 key;
+  probe(T1 k) : key(k) {}
+  operator T1() const {
+    ++conversions;
+    return (key);
+  }
+};
+int probe::conversions = 0;
+
+bool operator<(const probe &x, const T1 &y) { return (x.key < y); }
+bool operator<(const T1 &x, const probe &y) { return (x < y.key); }
+
 template < typename T_MAP >
 void printContainers(T_MAP const &mp, bool print_content = true) {
   const T_SIZE_TYPE size = mp.size();
 
   std::cout << "size: " << size << std::endl;
   if (print_content) {
-    typename TESTED_NAMESPACE::map< T1, T2 >::const_iterator it = mp.begin();
-    typename TESTED_NAMESPACE::map< T1, T2 >::const_iterator ite = mp.end();
+    typename T_MAP::const_iterator it = mp.begin();
+    typename T_MAP::const_iterator ite = mp.end();
     std::cout << "Content is:" << std::endl;
     for (; it != ite; ++it) {
       std::cout << "- KEY: " << (*it).first << "\t|\t VALUE: " << (*it).second
@@ -117,6 +260,47 @@ int main() {
   std::cout << "count 5: " << mp_ot.count(5) << std::endl;
   std::cout << "count 20: " << mp_ot.count(20) << std::endl;
 
+  std::cout << "  == swap iterator validity test ==" << std::endl;
+  {
+    typedef TESTED_NAMESPACE::map< T1, T2 > swap_type;
+    swap_type big;
+    swap_type small;
+    swap_type empty;
+    for (int i = 0; i < 10; ++i) {
+      big[i] = "v";
+    }
+    for (int i = 0; i < 3; ++i) {
+      small[100 + i] = "w";
+    }
+    swap_type::iterator it_big = big.find(5);
+    swap_type::iterator it_small = small.begin();
+
+    big.swap(small);
+    std::cout << "member swap sizes: " << big.size() << " " << small.size()
+              << std::endl;
+    std::cout << "from 5 to end: ";
+    for (swap_type::iterator it = it_big; it != small.end(); ++it) {
+      std::cout << it->first << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "moved begin: " << (it_small == big.begin()) << std::endl;
+
+    swap(small, empty);
+    std::cout << "swap with empty: " << small.empty() << " " << empty.size()
+              << std::endl;
+    std::cout << "small begin == end: " << (small.begin() == small.end())
+              << std::endl;
+    empty.erase(it_big);
+    std::cout << "from 6 to end: ";
+    for (swap_type::iterator it = empty.find(6); it != empty.end(); ++it) {
+      std::cout << it->first << " ";
+    }
+    std::cout << std::endl;
+    TESTED_NAMESPACE::swap(big, small);
+    printContainers(big);
+    printContainers(small);
+  }
+
   std::cout << "  == lower & upper_bound / equal_range test ==" << std::endl;
   std::cout << "lower_bound " << mp_ot.lower_bound(5)->first << std::endl;
   std::cout << "upper_bound " << mp_ot.upper_bound(5)->first << std::endl;
@@ -173,5 +357,394 @@ int main() {
   std::cout << "operator >=" << std::endl;
   std::cout << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
 
+  std::cout << "  == unsorted / duplicated range test ==" << std::endl;
+  {
+    std::list< T3 > dup;
+    for (unsigned int i = 0; i < 20; ++i) {
+      dup.push_back(T3((i * 7) % 11, std::string(i % 5 + 1, i + 65)));
+    }
+    TESTED_NAMESPACE::map< T1, T2 > mp_dup(dup.begin(), dup.end());
+    printContainers(mp_dup);
+    TESTED_NAMESPACE::map< T1, T2 > mp_sorted(mp_dup.begin(), mp_dup.end());
+    printContainers(mp_sorted);
+    mp_sorted.insert(lst.begin(), lst.end());
+    printContainers(mp_sorted);
+  }
+
+  std::cout << "  == custom compare / allocator test ==" << std::endl;
+  {
+    typedef TESTED_NAMESPACE::map< T1, T2, order_less, tagged_allocator< T3 > >
+        custom_map;
+    custom_map cmp(order_less(true), tagged_allocator< T3 >(42));
+    for (unsigned int i = 0; i < 5; ++i) {
+      cmp.insert(T3(i, std::string(i + 1, i + 65)));
+    }
+    custom_map cmp_copy(cmp);
+    cmp_copy[7] = "Seven";
+    for (custom_map::iterator it = cmp_copy.begin(); it != cmp_copy.end();
+         ++it) {
+      std::cout << "- KEY: " << it->first << "\t|\t VALUE: " << it->second
+                << std::endl;
+    }
+    std::cout << "lower_bound 3: " << cmp_copy.lower_bound(3)->first
+              << std::endl;
+    std::cout << "key_comp reverse: " << cmp_copy.key_comp().reverse
+              << std::endl;
+    std::cout << "value_comp(4, 2): "
+              << cmp_copy.value_comp()(T3(4, "a"), T3(2, "b")) << std::endl;
+    std::cout << "allocator id: " << cmp_copy.get_allocator().id << std::endl;
+  }
+
+  std::cout << "  == nth / rank / distance test ==" << std::endl;
+  {
+    ranked_map rmp;
+    for (int i = 0; i < 20; ++i) {
+      rmp[(i * 7) % 20 * 3] = std::string(1, 'a' + i);
+    }
+    rmp.erase(9);
+    rmp.erase(rmp.begin());
+    rmp.erase(rmp.lower_bound(30), rmp.lower_bound(42));
+    rmp.insert(rmp.end(), T3(100, "z"));
+    const ranked_map rcopy(rmp);
+    for (size_t k = 0; k <= rcopy.size(); k += 3) {
+      ranked_map::const_iterator it = nth(rcopy, k);
+      std::cout << "nth(" << k << "): ";
+      if (it == rcopy.end()) {
+        std::cout << "end" << std::endl;
+      } else {
+        std::cout << it->first << " " << it->second << std::endl;
+      }
+    }
+    std::cout << "nth(size) is end: "
+              << (nth(rcopy, rcopy.size()) == rcopy.end()) << std::endl;
+    int keys[] = {-1, 0, 9, 10, 29, 42, 57, 100, 1000};
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i) {
+      std::cout << "rank(" << keys[i] << "): " << rank(rcopy, keys[i])
+                << std::endl;
+    }
+    std::cout << "distance(begin, end): "
+              << RANKED_DISTANCE(rcopy.begin(), rcopy.end()) << std::endl;
+    std::cout << "distance(lower_bound(20), upper_bound(60)): "
+              << RANKED_DISTANCE(rcopy.lower_bound(20), rcopy.upper_bound(60))
+              << std::endl;
+    ranked_map rempty;
+    std::cout << "empty: " << rank(rempty, 3) << " "
+              << (nth(rempty, 0) == rempty.end()) << " "
+              << RANKED_DISTANCE(rempty.begin(), rempty.end()) << std::endl;
+  }
+
+  std::cout << "  == freeze test ==" << std::endl;
+  {
+    TESTED_NAMESPACE::map< T1, T2 > src;
+    for (int i = 0; i < 30; ++i) {
+      src[(i * 11) % 31] = std::string(i % 4 + 1, 'a' + i % 26);
+    }
+    const frozen_map_type frozen = freeze(src);
+    src.clear();
+    src[1000] = "after freeze";
+    std::cout << "size: " << frozen.size() << std::endl;
+    for (frozen_map_type::const_iterator it = frozen.begin();
+         it != frozen.end(); ++it) {
+      std::cout << it->first << ":" << (*it).second << " ";
+    }
+    std::cout << std::endl;
+    for (frozen_map_type::const_reverse_iterator it = frozen.rbegin();
+         it != frozen.rend(); ++it) {
+      std::cout << it->first << " ";
+    }
+    std::cout << std::endl;
+    int keys[] = {-1, 0, 5, 15, 29, 30, 31, 100};
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i) {
+      frozen_map_type::const_iterator found = frozen.find(keys[i]);
+      frozen_map_type::const_iterator lower = frozen.lower_bound(keys[i]);
+      frozen_map_type::const_iterator upper = frozen.upper_bound(keys[i]);
+      std::cout << keys[i] << ": count " << frozen.count(keys[i]) << ", find "
+                << (found == frozen.end() ? "end" : found->second)
+                << ", lower_bound ";
+      if (lower == frozen.end()) {
+        std::cout << "end";
+      } else {
+        std::cout << lower->first;
+      }
+      std::cout << ", upper_bound ";
+      if (upper == frozen.end()) {
+        std::cout << "end";
+      } else {
+        std::cout << upper->first;
+      }
+      std::cout << std::endl;
+    }
+    TESTED_NAMESPACE::map< T1, T2 > empty_src;
+    const frozen_map_type frozen_empty = freeze(empty_src);
+    std::cout << "empty: " << frozen_empty.empty() << " "
+              << (frozen_empty.begin() == frozen_empty.end()) << std::endl;
+  }
+
+  std::cout << "  == transparent compare test ==" << std::endl;
+  {
+    transparent_map tmp;
+    for (int i = 0; i < 10; ++i) {
+      tmp[i * 2] = std::string(i + 1, 'a' + i);
+    }
+    const transparent_map &ctmp = tmp;
+    probe::conversions = 0;
+    std::cout << "find 4: " << tmp.find(TRANSPARENT_KEY(probe(4)))->second
+              << std::endl;
+    std::cout << "find 7 is end: "
+              << (ctmp.find(TRANSPARENT_KEY(probe(7))) == ctmp.end())
+              << std::endl;
+    std::cout << "count 5 / 6: " << tmp.count(TRANSPARENT_KEY(probe(5)))
+              << tmp.count(TRANSPARENT_KEY(probe(6))) << std::endl;
+    std::cout << "lower_bound 5: "
+              << tmp.lower_bound(TRANSPARENT_KEY(probe(5)))->first
+              << std::endl;
+    std::cout << "upper_bound 6: "
+              << ctmp.upper_bound(TRANSPARENT_KEY(probe(6)))->first
+              << std::endl;
+    std::cout << "equal_range 8: "
+              << tmp.equal_range(TRANSPARENT_KEY(probe(8))).first->first
+              << ", "
+              << ctmp.equal_range(TRANSPARENT_KEY(probe(8))).second->first
+              << std::endl;
+    std::cout << "transparent conversions: " << probe::conversions
+              << std::endl;
+
+    // transparent가 아니면 key_type 함수가 불리고, probe는 바뀐다.
+    TESTED_NAMESPACE::map< T1, T2 > plain(tmp.begin(), tmp.end());
+    probe::conversions = 0;
+    std::cout << "find 4: " << plain.find(probe(4))->second << std::endl;
+    std::cout << "count 5: " << plain.count(probe(5)) << std::endl;
+    std::cout << "lower_bound 5: " << plain.lower_bound(probe(5))->first
+              << std::endl;
+    std::cout << "key_type conversions: " << probe::conversions << std::endl;
+  }
+
+  std::cout << "  == pool allocator test ==" << std::endl;
+  {
+    typedef TESTED_NAMESPACE::map< T1, T2, std::less< T1 >,
+                                   ft::pool_allocator< T3 > >
+        pool_map;
+    pool_map pmp;
+    for (int i = 0; i < 40; ++i) {
+      pmp[(i * 7) % 40] = std::string(i % 3 + 1, 'a' + i % 26);
+    }
+    const T3 *freed = &*pmp.find(13);
+    pmp.erase(13);
+    pmp[13] = "reused";
+    std::cout << "erased node reused: " << (&*pmp.find(13) == freed)
+              << std::endl;
+    for (int i = 0; i < 40; i += 3) {
+      pmp.erase(i);
+    }
+    printContainers(pmp);
+
+    pool_map pcopy(pmp);
+    pool_map::iterator end_before = pmp.end();
+    pmp.clear();
+    // nil은 pool 밖에 있으므로 clear 전의 end()도 계속 쓸 수 있다.
+    std::cout << "end() kept after clear: " << (pmp.end() == end_before)
+              << std::endl;
+    printContainers(pmp);
+    for (int i = 0; i < 5; ++i) {
+      pmp[i * 100] = "again";
+    }
+    pmp.insert(T3(200, "dup"));
+    pool_map::iterator walk = pmp.begin();
+    while (walk != pmp.end() && walk != end_before) {
+      ++walk;
+    }
+    std::cout << "old end() reached: " << (walk == end_before) << std::endl;
+    printContainers(pmp);
+    printContainers(pcopy, false);
+
+    pmp.swap(pcopy);
+    pmp.erase(pmp.begin(), pmp.find(20));
+    pcopy[50] = "after swap";
+    printContainers(pmp);
+    printContainers(pcopy);
+    pcopy = pmp;
+    pmp.clear();
+    printContainers(pcopy);
+
+    ft::pool_allocator< T1 > pa;
+    T1 *slot = pa.allocate(1);
+    pa.deallocate(slot, 1);
+    ft::pool_allocator< T1 > pa_copy(pa);
+    std::cout << "copy shares free list: " << (pa_copy.allocate(1) == slot)
+              << std::endl;
+    ft::pool_allocator< long > pa_rebind(pa);
+    std::cout << "rebind has own pool: " << (pa_rebind != pa) << std::endl;
+  }
+
+  std::cout << "  == counting allocator test ==" << std::endl;
+  {
+    typedef TESTED_NAMESPACE::map< T1, T2, std::less< T1 >,
+                                   ft::counting_allocator< T3 > >
+        counted_map;
+    ft::alloc_stats stats;
+    {
+      counted_map cnt((std::less< T1 >()),
+                      ft::counting_allocator< T3 >(stats));
+      stats.begin_ops();
+      for (int i = 0; i < 10; ++i) {
+        cnt.insert(T3(i, "value"));
+        stats.end_op();
+      }
+      std::cout << "inserts without allocation: " << stats.histogram[0]
+                << std::endl;
+      stats.begin_ops();
+      cnt.insert(T3(3, "duplicated"));
+      stats.end_op();
+      cnt.find(5);
+      stats.end_op();
+      std::cout << "duplicated insert / find allocations: "
+                << stats.op_allocations << std::endl;
+      stats.begin_ops();
+      cnt[3] = "assigned";
+      stats.end_op();
+      TRY_EMPLACE(cnt, 4, "again");
+      stats.end_op();
+      std::cout << "existing [] / try_emplace allocations: "
+                << stats.op_allocations << std::endl;
+      std::cout << "value kept: " << cnt[3] << " " << cnt[4] << std::endl;
+      std::cout << "in use while alive: " << (stats.bytes_in_use > 0)
+                << std::endl;
+      counted_map cnt_copy(cnt);
+      std::cout << "copy uses the same stats: "
+                << (&cnt_copy.get_allocator().stats() == &stats) << std::endl;
+    }
+    std::cout << "allocations == deallocations: "
+              << (stats.allocations == stats.deallocations) << std::endl;
+    std::cout << "in use after scope: " << stats.bytes_in_use << std::endl;
+    std::cout << "peak >= 20 values: "
+              << (stats.peak_bytes >= 20 * sizeof(T3)) << std::endl;
+  }
+
+  std::cout << "  == try_emplace copy test ==" << std::endl;
+  {
+    TESTED_NAMESPACE::map< T1, copy_counter > ccm;
+    const copy_counter obj(5);
+    copy_counter::copies = 0;
+    std::cout << "inserted: " << TRY_EMPLACE(ccm, 1, obj).second << std::endl;
+    std::cout << "new key copied once: " << COPIED_ONCE(copy_counter::copies)
+              << std::endl;
+    std::cout << "inserted dup: " << TRY_EMPLACE(ccm, 1, copy_counter(7)).second
+              << std::endl;
+    copy_counter::copies = 0;
+    ccm[1].val += 10;
+    std::cout << "existing [] copies: " << copy_counter::copies << std::endl;
+    ccm[2];
+    std::cout << "values: " << ccm[1].val << " " << ccm[2].val << std::endl;
+
+    // key가 이미 있으면 mapped_type()도 만들지 않는다.
+    copy_counter::defaults = 0;
+    ccm[1].val += 1;
+    TRY_EMPLACE_KEY(ccm, 2);
+    std::cout << "existing key defaults: " << copy_counter::defaults
+              << std::endl;
+    std::cout << "inserted key: " << TRY_EMPLACE_KEY(ccm, 3).second
+              << std::endl;
+    ccm[4];
+    std::cout << "new key defaults: " << copy_counter::defaults << std::endl;
+  }
+
+#if __cplusplus >= 201103L
+  std::cout << "  == move / emplace test (C++11) ==" << std::endl;
+  {
+    TESTED_NAMESPACE::map< T1, T2 > mp_src;
+    std::cout << "emplace: " << mp_src.emplace(3, "three").second << std::endl;
+    std::cout << "emplace: " << mp_src.emplace(1, std::string(5, 'o')).second
+              << std::endl;
+    std::cout << "emplace dup: " << mp_src.emplace(3, "again").second
+              << std::endl;
+    mp_src.emplace_hint(mp_src.end(), 9, "nine");
+    mp_src.emplace_hint(mp_src.begin(), 0, "zero");
+    mp_src.insert(TESTED_NAMESPACE::make_pair(4, std::string(4, 'f')));
+    T1 key = 7;
+    mp_src[std::move(key)] = "seven";
+    printContainers(mp_src);
+
+    TESTED_NAMESPACE::map< T1, T2 > mp_moved(std::move(mp_src));
+    std::cout << "moved-from size: " << mp_src.size() << std::endl;
+    printContainers(mp_moved);
+
+    TESTED_NAMESPACE::map< T1, T2 > mp_assigned;
+    mp_assigned[100] = "old";
+    mp_assigned = std::move(mp_moved);
+    printContainers(mp_assigned);
+    mp_moved[1] = "reused";
+    printContainers(mp_moved);
+  }
+
+  std::cout << "  == noexcept move test (C++11) ==" << std::endl;
+  {
+    typedef TESTED_NAMESPACE::map< T1, T2 > plain_map;
+    std::cout << "nothrow move construct / assign: "
+              << std::is_nothrow_move_constructible< plain_map >::value
+              << std::is_nothrow_move_assignable< plain_map >::value
+              << std::endl;
+
+    typedef TESTED_NAMESPACE::map< T1, T2, std::less< T1 >,
+                                   ft::counting_allocator< T3 > >
+        counted_map;
+    ft::alloc_stats stats;
+    {
+      counted_map src((std::less< T1 >()),
+                      ft::counting_allocator< T3 >(stats));
+      for (int i = 0; i < 5; ++i) {
+        src[i] = "moved";
+      }
+      counted_map assigned((std::less< T1 >()),
+                           ft::counting_allocator< T3 >(stats));
+      assigned[42] = "old";
+      stats.begin_ops();
+      counted_map dst(std::move(src));
+      stats.end_op();
+      assigned = std::move(dst);
+      stats.end_op();
+      std::cout << "move allocations: " << stats.histogram[0] << " of "
+                << stats.ops << std::endl;
+      std::cout << "moved-from: " << src.size() << src.empty()
+                << (src.begin() == src.end()) << (src.find(1) == src.end())
+                << src.count(1) << (src.lower_bound(0) == src.end())
+                << std::endl;
+      src[7] = "reused";
+      src.insert(T3(8, "again"));
+      printContainers(src);
+      printContainers(assigned);
+      dst = src;
+      printContainers(dst);
+    }
+    std::cout << "allocations == deallocations: "
+              << (stats.allocations == stats.deallocations) << std::endl;
+
+    // 재할당 때 map을 복사하지 않고 move 하는지. (노드 주소가 그대로)
+    TESTED_NAMESPACE::vector< plain_map > maps;
+    maps.push_back(plain_map());
+    maps[0][1] = "first";
+    const T2 *first_value = &maps[0][1];
+    for (int i = 0; i < 20; ++i) {
+      maps.push_back(plain_map());
+    }
+    std::cout << "map moved on reallocation: "
+              << (&maps[0].find(1)->second == first_value) << std::endl;
+
+    typedef TESTED_NAMESPACE::map< T1, T2, std::less< T1 >,
+                                   ft::pool_allocator< T3 > >
+        pool_map;
+    pool_map pool_src;
+    for (int i = 0; i < 10; ++i) {
+      pool_src[i] = "pool";
+    }
+    pool_map pool_dst(std::move(pool_src));
+    pool_src[100] = "reused";
+    pool_src.clear();
+    pool_src[200] = "after clear";
+    pool_dst.erase(3);
+    printContainers(pool_src);
+    printContainers(pool_dst);
+  }
+#endif
+
   // system("leaks map");
 }
@@ -11,11 +11,16 @@
 /* ************************************************************************** */
 
 #include "set.hpp"
+#include "pool_allocator.hpp"
 
 #include <iostream>
 #include <list>
 #include <set>
 #include <string>
+#include <utility>
+#if __cplusplus >= 201103L
+#include <type_traits>
+#endif
 
 #ifndef TESTED_NAMESPACE
 #define TESTED_NAMESPACE ft
@@ -25,14 +30,76 @@
 #define T3 TESTED_NAMESPACE::set< T1 >::value_type
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::set< T1 >::size_type
 
+// std::set에는 freeze가 없으므로 같은 내용의 std::set 복사본과 비교한다.
+#define IS_STD_std 1
+#define IS_STD_ft 0
+#define CAT(a, b) a##b
+#define XCAT(a, b) CAT(a, b)
+
+#if XCAT(IS_STD_, TESTED_NAMESPACE)
+typedef std::set< T1 > frozen_set_type;
+frozen_set_type freeze(const std::set< T1 > &st) { return (st); }
+
+// std::less<void>는 C++14부터 있으므로 probe의 key를 직접 넘긴다.
+typedef std::set< T1 > transparent_set;
+#define TRANSPARENT_KEY(x) (x).key
+#else
+typedef ft::set< T1 >::frozen_type frozen_set_type;
+frozen_set_type freeze(const ft::set< T1 > &st) { return (st.freeze()); }
+
+typedef ft::set< T1, ft::less< void > > transparent_set;
+#define TRANSPARENT_KEY(x) (x)
+#endif
+
+// 상태를 갖는 comparator. (reverse가 true면 내림차순)
+struct order_less {
+  bool reverse;
+  order_less(bool r = false) : reverse(r) {}
+  bool operator()(const T1 &x, const T1 &y) const {
+    return (reverse ? y < x : x < y);
+  }
+};
+
+// 상태(id)를 갖는 allocator.
+template < typename T >
+struct tagged_allocator : public std::allocator< T > {
+  int id;
+  template < typename U >
+  struct rebind {
+    typedef tagged_allocator< U > other;
+  };
+  tagged_allocator(int i = 0) : std::allocator< T >(), id(i) {}
+  template < typename U >
+  tagged_allocator(const tagged_allocator< U > &ot)
+      : std::allocator< T >(), id(ot.id) {}
+};
+
+/**
+ * key_type이 아닌 탐색용 type. key_type으로 바뀔 때마다 conversions를
+ * 센다. transparent comparator면 바뀌지 않고 그대로 비교되어야 한다.
+ */
+struct probe {
+  static int conversions;
+  T1 key;
+  probe(T1 k) : key(k) {}
+  operator T1() const {
+    ++conversions;
+    return (key);
+  }
+};
+int probe::conversions = 0;
+
+bool operator<(const probe &x, const T1 &y) { return (x.key < y); }
+bool operator<(const T1 &x, const probe &y) { return (x < y.key); }
+
 template < typename T_SET >
 void printContainers(T_SET const &st, bool print_content = true) {
   const T_SIZE_TYPE size = st.size();
 
   std::cout << "size: " << size << std::endl;
   if (print_content) {
-    typename TESTED_NAMESPACE::set< T1 >::const_iterator it = st.begin();
-    typename TESTED_NAMESPACE::set< T1 >::const_iterator ite = st.end();
+    typename T_SET::const_iterator it = st.begin();
+    typename T_SET::const_iterator ite = st.end();
     std::cout << "Content is:" << std::endl;
     for (; it != ite; ++it) {
       std::cout << "- KEY: " << (*it) << std::endl;
@@ -110,6 +177,47 @@ int main() {
   std::cout << "count 5: " << st_ot.count(5) << std::endl;
   std::cout << "count 20: " << st_ot.count(20) << std::endl;
 
+  std::cout << "  == swap iterator validity test ==" << std::endl;
+  {
+    typedef TESTED_NAMESPACE::set< T1 > swap_type;
+    swap_type big;
+    swap_type small;
+    swap_type empty;
+    for (int i = 0; i < 10; ++i) {
+      big.insert(i);
+    }
+    for (int i = 0; i < 3; ++i) {
+      small.insert(100 + i);
+    }
+    swap_type::iterator it_big = big.find(5);
+    swap_type::iterator it_small = small.begin();
+
+    big.swap(small);
+    std::cout << "member swap sizes: " << big.size() << " " << small.size()
+              << std::endl;
+    std::cout << "from 5 to end: ";
+    for (swap_type::iterator it = it_big; it != small.end(); ++it) {
+      std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+    std::cout << "moved begin: " << (it_small == big.begin()) << std::endl;
+
+    swap(small, empty);
+    std::cout << "swap with empty: " << small.empty() << " " << empty.size()
+              << std::endl;
+    std::cout << "small begin == end: " << (small.begin() == small.end())
+              << std::endl;
+    empty.erase(it_big);
+    std::cout << "from 6 to end: ";
+    for (swap_type::iterator it = empty.find(6); it != empty.end(); ++it) {
+      std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+    TESTED_NAMESPACE::swap(big, small);
+    printContainers(big);
+    printContainers(small);
+  }
+
   std::cout << "  == lower & upper_bound / equal_range test ==" << std::endl;
   std::cout << "lower_bound " << *st_ot.lower_bound(5) << std::endl;
   std::cout << "upper_bound " << *st_ot.upper_bound(5) << std::endl;
@@ -145,5 +253,200 @@ int main() {
   std::cout << "operator >=" << std::endl;
   std::cout << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
 
+  std::cout << "  == unsorted / duplicated range test ==" << std::endl;
+  {
+    std::list< T3 > dup;
+    for (unsigned int i = 0; i < 20; ++i) {
+      dup.push_back(T3((i * 7) % 11));
+    }
+    TESTED_NAMESPACE::set< T1 > st_dup(dup.begin(), dup.end());
+    printContainers(st_dup);
+    TESTED_NAMESPACE::set< T1 > st_sorted(st_dup.begin(), st_dup.end());
+    printContainers(st_sorted);
+    st_sorted.insert(lst.begin(), lst.end());
+    printContainers(st_sorted);
+  }
+
+  std::cout << "  == custom compare / allocator test ==" << std::endl;
+  {
+    typedef TESTED_NAMESPACE::set< T1, order_less, tagged_allocator< T1 > >
+        custom_set;
+    custom_set cst(order_less(true), tagged_allocator< T1 >(42));
+    for (unsigned int i = 0; i < 5; ++i) {
+      cst.insert(i * 3);
+    }
+    custom_set cst_copy(cst);
+    cst_copy.insert(7);
+    for (custom_set::iterator it = cst_copy.begin(); it != cst_copy.end();
+         ++it) {
+      std::cout << "- KEY: " << *it << std::endl;
+    }
+    std::cout << "lower_bound 5: " << *cst_copy.lower_bound(5) << std::endl;
+    std::cout << "key_comp reverse: " << cst_copy.key_comp().reverse
+              << std::endl;
+    std::cout << "value_comp(4, 2): " << cst_copy.value_comp()(4, 2)
+              << std::endl;
+    std::cout << "allocator id: " << cst_copy.get_allocator().id << std::endl;
+  }
+
+  std::cout << "  == transparent compare test ==" << std::endl;
+  {
+    transparent_set tst;
+    for (int i = 0; i < 10; ++i) {
+      tst.insert(i * 2);
+    }
+    const transparent_set &ctst = tst;
+    probe::conversions = 0;
+    std::cout << "find 4: " << *tst.find(TRANSPARENT_KEY(probe(4)))
+              << std::endl;
+    std::cout << "find 7 is end: "
+              << (ctst.find(TRANSPARENT_KEY(probe(7))) == ctst.end())
+              << std::endl;
+    std::cout << "count 5 / 6: " << tst.count(TRANSPARENT_KEY(probe(5)))
+              << tst.count(TRANSPARENT_KEY(probe(6))) << std::endl;
+    std::cout << "lower_bound 5: "
+              << *tst.lower_bound(TRANSPARENT_KEY(probe(5))) << std::endl;
+    std::cout << "upper_bound 6: "
+              << *ctst.upper_bound(TRANSPARENT_KEY(probe(6))) << std::endl;
+    std::cout << "equal_range 8: "
+              << *tst.equal_range(TRANSPARENT_KEY(probe(8))).first << ", "
+              << *ctst.equal_range(TRANSPARENT_KEY(probe(8))).second
+              << std::endl;
+    std::cout << "transparent conversions: " << probe::conversions
+              << std::endl;
+
+    // transparent가 아니면 key_type 함수가 불리고, probe는 바뀐다.
+    TESTED_NAMESPACE::set< T1 > plain(tst.begin(), tst.end());
+    probe::conversions = 0;
+    std::cout << "find 4: " << *plain.find(probe(4)) << std::endl;
+    std::cout << "count 5: " << plain.count(probe(5)) << std::endl;
+    std::cout << "lower_bound 5: " << *plain.lower_bound(probe(5))
+              << std::endl;
+    std::cout << "key_type conversions: " << probe::conversions << std::endl;
+  }
+
+  std::cout << "  == pool allocator test ==" << std::endl;
+  {
+    typedef TESTED_NAMESPACE::set< T1, std::less< T1 >,
+                                   ft::pool_allocator< T1 > >
+        pool_set;
+    pool_set pst;
+    for (int i = 0; i < 40; ++i) {
+      pst.insert((i * 7) % 40);
+    }
+    const T1 *freed = &*pst.find(13);
+    pst.erase(13);
+    pst.insert(13);
+    std::cout << "erased node reused: " << (&*pst.find(13) == freed)
+              << std::endl;
+    for (int i = 0; i < 40; i += 3) {
+      pst.erase(i);
+    }
+    printContainers(pst);
+
+    pool_set pcopy(pst);
+    pool_set::iterator end_before = pst.end();
+    pst.clear();
+    // nil은 pool 밖에 있으므로 clear 전의 end()도 계속 쓸 수 있다.
+    std::cout << "end() kept after clear: " << (pst.end() == end_before)
+              << std::endl;
+    printContainers(pst);
+    for (int i = 0; i < 5; ++i) {
+      pst.insert(i * 100);
+    }
+    std::cout << "insert dup: " << pst.insert(200).second << std::endl;
+    pool_set::iterator walk = pst.begin();
+    while (walk != pst.end() && walk != end_before) {
+      ++walk;
+    }
+    std::cout << "old end() reached: " << (walk == end_before) << std::endl;
+    printContainers(pst);
+    printContainers(pcopy, false);
+
+    pst.swap(pcopy);
+    pst.erase(pst.begin(), pst.find(20));
+    pcopy.insert(50);
+    printContainers(pst);
+    printContainers(pcopy);
+    pcopy = pst;
+    pst.clear();
+    printContainers(pcopy);
+  }
+
+  std::cout << "  == freeze test ==" << std::endl;
+  {
+    TESTED_NAMESPACE::set< T1 > src;
+    for (int i = 0; i < 25; ++i) {
+      src.insert((i * 7) % 26 * 2);
+    }
+    const frozen_set_type frozen = freeze(src);
+    src.clear();
+    std::cout << "size: " << frozen.size() << std::endl;
+    for (frozen_set_type::const_reverse_iterator it = frozen.rbegin();
+         it != frozen.rend(); ++it) {
+      std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+    int keys[] = {-1, 0, 7, 8, 49, 50, 51};
+    for (size_t i = 0; i < sizeof(keys) / sizeof(keys[0]); ++i) {
+      frozen_set_type::const_iterator lower = frozen.lower_bound(keys[i]);
+      std::cout << keys[i] << ": count " << frozen.count(keys[i])
+                << ", find end " << (frozen.find(keys[i]) == frozen.end())
+                << ", lower_bound ";
+      if (lower == frozen.end()) {
+        std::cout << "end";
+      } else {
+        std::cout << *lower;
+      }
+      std::cout << std::endl;
+    }
+  }
+
+#if __cplusplus >= 201103L
+  std::cout << "  == move / emplace test (C++11) ==" << std::endl;
+  {
+    TESTED_NAMESPACE::set< std::string > st_src;
+    std::string word(12, 'w');
+    st_src.insert(std::move(word));
+    std::cout << "emplace: " << st_src.emplace(3, 'a').second << std::endl;
+    std::cout << "emplace dup: " << st_src.emplace("aaa").second << std::endl;
+    st_src.emplace_hint(st_src.end(), "zzz");
+
+    TESTED_NAMESPACE::set< std::string > st_moved(std::move(st_src));
+    std::cout << "moved-from size: " << st_src.size() << std::endl;
+    TESTED_NAMESPACE::set< std::string > st_assigned;
+    st_assigned.insert("old");
+    st_assigned = std::move(st_moved);
+    for (TESTED_NAMESPACE::set< std::string >::iterator it =
+             st_assigned.begin();
+         it != st_assigned.end(); ++it) {
+      std::cout << "- KEY: " << *it << std::endl;
+    }
+  }
+  std::cout << "  == noexcept move test (C++11) ==" << std::endl;
+  {
+    typedef TESTED_NAMESPACE::set< T1 > plain_set;
+    std::cout << "nothrow move construct / assign: "
+              << std::is_nothrow_move_constructible< plain_set >::value
+              << std::is_nothrow_move_assignable< plain_set >::value
+              << std::endl;
+    plain_set src;
+    for (int i = 0; i < 5; ++i) {
+      src.insert(i * 2);
+    }
+    plain_set dst(std::move(src));
+    std::cout << "moved-from: " << src.size() << (src.begin() == src.end())
+              << (src.find(2) == src.end()) << src.count(2)
+              << (src.upper_bound(0) == src.end()) << std::endl;
+    src.insert(3);
+    src = dst;
+    src.insert(11);
+    dst = std::move(src);
+    src.insert(1);
+    printContainers(src);
+    printContainers(dst);
+  }
+#endif
+
   // system("leaks set");
 }
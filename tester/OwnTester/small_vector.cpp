@@ -0,0 +1,299 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "small_vector.hpp"
+
+#include <iostream>
+#include <list>
+#include <stack>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "counting_allocator.hpp"
+#include "stack.hpp"
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+// std에는 small_vector가 없으므로 std::vector의 출력과 비교한다.
+#define IS_STD_std 1
+#define IS_STD_ft 0
+#define CAT(a, b) a##b
+#define XCAT(a, b) CAT(a, b)
+
+#if XCAT(IS_STD_, TESTED_NAMESPACE)
+#define SMALL_VECTOR(T, N) std::vector< T >
+#define SMALL_VECTOR_ALLOC(T, N, A) std::vector< T, A >
+#else
+#define SMALL_VECTOR(T, N) ft::small_vector< T, N >
+#define SMALL_VECTOR_ALLOC(T, N, A) ft::small_vector< T, N, A >
+#endif
+
+#define TESTED_TYPE int
+#define INLINE_SIZE 4
+#define TESTED_VECTOR SMALL_VECTOR(TESTED_TYPE, INLINE_SIZE)
+
+template < typename Vector >
+void printContainers(Vector const &vct, bool print_content = true) {
+  const typename Vector::size_type size = vct.size();
+  const typename Vector::size_type capacity = vct.capacity();
+  const std::string isCapacityOk = (capacity >= size) ? "OK" : "KO";
+
+  std::cout << "size: " << size << std::endl;
+  std::cout << "capacity: " << isCapacityOk << std::endl;
+  if (print_content) {
+    typename Vector::const_iterator it = vct.begin();
+    typename Vector::const_iterator ite = vct.end();
+    std::cout << std::endl << "Content is:" << std::endl;
+    for (; it != ite; ++it) {
+      std::cout << "- " << *it << std::endl;
+    }
+  }
+  std::cout << "###############################################" << std::endl;
+}
+
+// 대입 연산자가 budget번째 대입에서 예외를 던지는 type.
+// live는 살아있는 객체 수. (leak 확인용)
+struct thrower {
+  static int budget;
+  static int live;
+  int val;
+
+  thrower(int v = 0) : val(v) { ++live; }
+  thrower(const thrower &ot) : val(ot.val) { ++live; }
+  thrower &operator=(const thrower &ot) {
+    if (budget >= 0 && budget-- == 0) throw(std::runtime_error("assign"));
+    this->val = ot.val;
+    return (*this);
+  }
+  ~thrower() { --live; }
+};
+
+int thrower::budget = -1;
+int thrower::live = 0;
+
+/**
+ * capacity가 충분한 상태에서 pos 뒤에 n개를 넣다가 budget번째 대입에서
+ * 예외가 나면, 새로 만든 element가 모두 정리됐는지 본다.
+ * (대입하던 element의 값은 구현마다 다르므로 출력하지 않는다)
+ */
+template < typename Vector >
+void assignThrowTest(Vector &v, size_t n, int budget, bool range) {
+  const Vector src(n, thrower(8));
+
+  thrower::budget = budget;
+  try {
+    if (range) {
+      v.insert(v.begin() + 1, src.begin(), src.end());
+    } else {
+      v.insert(v.begin() + 1, n, thrower(5));
+    }
+    std::cout << "insert: no exception" << std::endl;
+  } catch (std::runtime_error &e) {
+    std::cout << "insert: caught " << e.what() << std::endl;
+  }
+  thrower::budget = -1;
+  std::cout << "live objects == size: "
+            << (thrower::live == static_cast< int >(v.size() + n) ? "OK"
+                                                                   : "KO")
+            << std::endl;
+}
+
+int main() {
+  std::cout << "////////// TEST SMALL_VECTOR //////////" << std::endl;
+
+  std::cout << "  == default / fill / range / copy constructor test =="
+            << std::endl;
+  TESTED_VECTOR sv_default;
+  TESTED_VECTOR sv_fill_small(3, 42);
+  TESTED_VECTOR sv_fill_big(7, 21);
+  TESTED_VECTOR sv_range(sv_fill_big.begin(), sv_fill_big.end() - 2);
+  TESTED_VECTOR sv_copy_small(sv_fill_small);
+  TESTED_VECTOR sv_copy_big(sv_fill_big);
+
+  printContainers(sv_default);
+  printContainers(sv_fill_small);
+  printContainers(sv_fill_big);
+  printContainers(sv_range);
+  printContainers(sv_copy_small);
+  printContainers(sv_copy_big);
+
+  std::cout << "  == push_back / pop_back across inline size test =="
+            << std::endl;
+  TESTED_VECTOR sv_push;
+  for (int i = 0; i < 10; ++i) {
+    sv_push.push_back(i * 2);
+    std::cout << "back: " << sv_push.back() << ", size: " << sv_push.size()
+              << std::endl;
+  }
+  printContainers(sv_push);
+  for (int i = 0; i < 8; ++i) {
+    sv_push.pop_back();
+  }
+  printContainers(sv_push);
+  // 자기 element를 push_back 하면서 heap으로 넘어가는 경우
+  TESTED_VECTOR sv_self(INLINE_SIZE, 7);
+  sv_self[0] = 3;
+  sv_self.push_back(sv_self[0]);
+  printContainers(sv_self);
+
+  std::cout << "  == insert / erase test ==" << std::endl;
+  TESTED_VECTOR sv_insert(2, 1);
+  sv_insert.insert(sv_insert.begin() + 1, 5);
+  printContainers(sv_insert);
+  sv_insert.insert(sv_insert.begin(), 3, 9);
+  printContainers(sv_insert);
+  std::list< TESTED_TYPE > lst;
+  for (int i = 100; i < 105; ++i) {
+    lst.push_back(i);
+  }
+  sv_insert.insert(sv_insert.begin() + 2, lst.begin(), lst.end());
+  printContainers(sv_insert);
+  sv_insert.insert(sv_insert.end(), sv_fill_small.begin(),
+                   sv_fill_small.end());
+  printContainers(sv_insert);
+  sv_insert.erase(sv_insert.begin() + 3);
+  printContainers(sv_insert);
+  sv_insert.erase(sv_insert.begin(), sv_insert.begin() + 8);
+  printContainers(sv_insert);
+
+  std::cout << "  == resize / reserve / assign test ==" << std::endl;
+  TESTED_VECTOR sv_resize;
+  sv_resize.resize(3, 8);
+  printContainers(sv_resize);
+  sv_resize.resize(9, 4);
+  printContainers(sv_resize);
+  sv_resize.resize(2);
+  printContainers(sv_resize);
+  sv_resize.reserve(20);
+  printContainers(sv_resize);
+  sv_resize.assign(6, 11);
+  printContainers(sv_resize);
+  sv_resize.assign(lst.begin(), lst.end());
+  printContainers(sv_resize);
+  sv_resize.assign(sv_fill_small.begin(), sv_fill_small.end());
+  printContainers(sv_resize);
+
+  std::cout << "  == operator= / swap test ==" << std::endl;
+  TESTED_VECTOR sv_a(2, 1);
+  TESTED_VECTOR sv_b(6, 2);
+  TESTED_VECTOR sv_c(8, 3);
+  TESTED_VECTOR sv_d(1, 4);
+
+  sv_a.swap(sv_b);
+  printContainers(sv_a);
+  printContainers(sv_b);
+  sv_a.swap(sv_c);
+  printContainers(sv_a);
+  printContainers(sv_c);
+  swap(sv_b, sv_d);
+  printContainers(sv_b);
+  printContainers(sv_d);
+  sv_a = sv_d;
+  printContainers(sv_a);
+  sv_d = sv_c;
+  printContainers(sv_d);
+
+  std::cout << "  == string element test ==" << std::endl;
+  {
+    SMALL_VECTOR(std::string, 2) sv_str;
+    sv_str.push_back("one");
+    sv_str.push_back("two");
+    sv_str.insert(sv_str.begin() + 1, "three");
+    sv_str.insert(sv_str.begin(), 2, "four");
+    sv_str.erase(sv_str.begin() + 2);
+    printContainers(sv_str);
+    SMALL_VECTOR(std::string, 2) sv_str_copy(sv_str);
+    sv_str_copy.resize(1);
+    sv_str_copy.swap(sv_str);
+    printContainers(sv_str);
+    printContainers(sv_str_copy);
+  }
+
+  std::cout << "  == throwing assignment insert test ==" << std::endl;
+  {
+    // 안쪽 buffer와 heap buffer, 뒤쪽 element가 n보다 많은 경우와 적은 경우
+    for (int heap = 0; heap < 2; ++heap) {
+      for (int range = 0; range < 2; ++range) {
+        for (size_t n = 2; n <= 6; n += 4) {
+          SMALL_VECTOR(thrower, 12) sv_throw;
+          // 12는 small_vector에서는 안쪽 buffer 그대로다.
+          sv_throw.reserve(heap ? 24 : 12);
+          for (int i = 0; i < 6; ++i) {
+            sv_throw.push_back(thrower(i));
+          }
+          assignThrowTest(sv_throw, n, 1, range);
+        }
+      }
+    }
+  }
+  std::cout << "live objects after scope: " << thrower::live << std::endl;
+
+  std::cout << "  == relational operators test ==" << std::endl;
+  TESTED_VECTOR lhs(3, 5);
+  TESTED_VECTOR rhs(lhs);
+  rhs.push_back(1);
+  std::cout << "operator ==: " << ((lhs == rhs) ? "OK" : "KO") << std::endl;
+  std::cout << "operator !=: " << ((lhs != rhs) ? "OK" : "KO") << std::endl;
+  std::cout << "operator <: " << ((lhs < rhs) ? "OK" : "KO") << std::endl;
+  std::cout << "operator <=: " << ((lhs <= rhs) ? "OK" : "KO") << std::endl;
+  std::cout << "operator >: " << ((lhs > rhs) ? "OK" : "KO") << std::endl;
+  std::cout << "operator >=: " << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
+
+  std::cout << "  == stack container test ==" << std::endl;
+  TESTED_NAMESPACE::stack< TESTED_TYPE, TESTED_VECTOR > st;
+  for (int i = 0; i < 6; ++i) {
+    st.push(i * 3 + 1);
+  }
+  TESTED_NAMESPACE::stack< TESTED_TYPE, TESTED_VECTOR > st_copy(st);
+  std::cout << "size: " << st.size() << std::endl;
+  while (!st.empty()) {
+    std::cout << "- " << st.top() << std::endl;
+    st.pop();
+  }
+  std::cout << "Is empty: " << (st.empty() ? "OK" : "KO") << std::endl;
+  std::cout << "operator ==: " << ((st == st_copy) ? "OK" : "KO") << std::endl;
+  std::cout << "operator <: " << ((st < st_copy) ? "OK" : "KO") << std::endl;
+
+#if __cplusplus >= 201103L
+  std::cout << "  == move assignment allocator test (C++11) ==" << std::endl;
+  {
+    typedef ft::counting_allocator< int > count_alloc;
+    typedef SMALL_VECTOR_ALLOC(int, 2, count_alloc) count_vector;
+    ft::alloc_stats stats_a;
+    ft::alloc_stats stats_b;
+    {
+      count_vector sv_heap(3, 2, (count_alloc(stats_b)));
+      count_vector sv_inline(1, 4, (count_alloc(stats_b)));
+      {
+        // heap buffer를 가져오는 경우와 element를 옮기는 경우
+        count_vector sv_big(5, 1, (count_alloc(stats_a)));
+        count_vector sv_small(1, 3, (count_alloc(stats_a)));
+        sv_heap = std::move(sv_big);
+        sv_inline = std::move(sv_small);
+      }
+      sv_heap.push_back(6);
+      sv_inline.push_back(5);
+      sv_inline.push_back(7);
+      printContainers(sv_heap);
+      printContainers(sv_inline);
+    }
+    // buffer는 자기를 할당한 allocator로 반환되어야 한다.
+    std::cout << "in use after scope: " << stats_a.bytes_in_use << ", "
+              << stats_b.bytes_in_use << std::endl;
+  }
+#endif
+
+  return (0);
+}
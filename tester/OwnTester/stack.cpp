@@ -15,6 +15,7 @@
 #include <iostream>
 #include <stack>
 #include <string>
+#include <utility>
 #include <vector>
 
 #ifndef TESTED_NAMESPACE
@@ -141,5 +142,21 @@ int main() {
   std::cout << "operator >=" << std::endl;
   std::cout << ((lhs >= rhs) ? "OK" : "KO") << std::endl;
 
+#if __cplusplus >= 201103L
+  std::cout << "  == move / emplace test (C++11) ==" << std::endl;
+  {
+    TESTED_NAMESPACE::stack< std::string > st_str;
+    std::string word(8, 's');
+    st_str.push(std::move(word));
+    st_str.emplace(3, 'e');
+    TESTED_NAMESPACE::stack< std::string > st_moved(std::move(st_str));
+    std::cout << "size: " << st_moved.size() << std::endl;
+    while (!st_moved.empty()) {
+      std::cout << "- " << st_moved.top() << std::endl;
+      st_moved.pop();
+    }
+  }
+#endif
+
   // system("leaks stack");
 }
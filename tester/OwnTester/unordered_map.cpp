@@ -0,0 +1,274 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_map.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "unordered_map.hpp"
+
+#include <iostream>
+#include <list>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+// std::unordered_map은 C++11부터 있으므로 std::map의 출력과 비교한다.
+// 순회 순서가 다르므로 출력은 항상 key 순으로 정렬해서 한다.
+#define IS_STD_std 1
+#define IS_STD_ft 0
+#define CAT(a, b) a##b
+#define XCAT(a, b) CAT(a, b)
+
+#define T1 int
+#define T2 std::string
+
+#if XCAT(IS_STD_, TESTED_NAMESPACE)
+#define UNORDERED_MAP(K, V, H) std::map< K, V >
+#define RESERVE(mp, n)
+#define REHASH(mp, n)
+#define MAX_LOAD(mp, ml)
+#define LOAD_OK(mp) true
+#define HASH_EQ(T, x, y) true
+
+// C++98의 std::map::erase(iterator)는 아무것도 리턴하지 않는다.
+template < typename C >
+typename C::iterator erase_at(C &c, typename C::iterator it) {
+  typename C::iterator next = it;
+
+  ++next;
+  c.erase(it);
+  return (next);
+}
+#define ERASE_AT(c, it) erase_at(c, it)
+#else
+#define UNORDERED_MAP(K, V, H) ft::unordered_map< K, V, H >
+#define RESERVE(mp, n) mp.reserve(n)
+#define REHASH(mp, n) mp.rehash(n)
+#define MAX_LOAD(mp, ml) mp.max_load_factor(ml)
+#define LOAD_OK(mp) \
+  (mp.load_factor() <= mp.max_load_factor() && mp.bucket_count() >= mp.size())
+#define HASH_EQ(T, x, y) (ft::hash< T >()(x) == ft::hash< T >()(y))
+#define ERASE_AT(c, it) c.erase(it)
+#endif
+
+// 모든 key가 같은 bucket으로 가는 hash. (충돌 처리 확인용)
+struct collide_hash {
+  size_t operator()(const T1 &) const { return (42); }
+};
+
+#define TESTED_MAP UNORDERED_MAP(T1, T2, TESTED_NAMESPACE::hash< T1 >)
+
+#define T3 TESTED_MAP::value_type
+
+template < typename T_MAP >
+void printContainers(T_MAP const &mp, bool print_content = true) {
+  std::cout << "size: " << mp.size() << std::endl;
+  if (print_content) {
+    std::map< typename T_MAP::key_type, typename T_MAP::mapped_type > sorted;
+    for (typename T_MAP::const_iterator it = mp.begin(); it != mp.end();
+         ++it) {
+      sorted.insert(std::make_pair((*it).first, it->second));
+    }
+    std::cout << "Content is:" << std::endl;
+    for (typename std::map< typename T_MAP::key_type,
+                            typename T_MAP::mapped_type >::const_iterator it =
+             sorted.begin();
+         it != sorted.end(); ++it) {
+      std::cout << "- KEY: " << it->first << "\t|\t VALUE: " << it->second
+                << std::endl;
+    }
+  }
+  std::cout << "###############################################" << std::endl;
+}
+
+int main() {
+  std::cout << "////////// TEST UNORDERED_MAP //////////" << std::endl;
+
+  std::cout << "  == default / range / copy constructor test ==" << std::endl;
+  TESTED_MAP mp;
+  printContainers(mp);
+
+  std::list< T3 > lst;
+  for (unsigned int i = 0; i < 10; ++i) {
+    lst.push_back(T3(10 - i, std::string(i + 1, i + 65)));
+  }
+  TESTED_MAP mp_range(lst.begin(), lst.end());
+  printContainers(mp_range);
+
+  TESTED_MAP mp_copy(mp_range);
+  printContainers(mp_copy);
+
+  std::cout << "  == size / clear / empty test ==" << std::endl;
+  mp_copy.clear();
+  printContainers(mp_copy);
+  std::cout << "Is empty: " << (mp_copy.empty() ? "OK" : "KO") << std::endl;
+
+  std::cout << "  == insert / erase / [] test ==" << std::endl;
+  RESERVE(mp_copy, 16);
+  std::cout << "insert 5: " << mp_copy.insert(T3(5, "five")).second
+            << std::endl;
+  std::cout << "insert 5 again: " << mp_copy.insert(T3(5, "FIVE")).second
+            << std::endl;
+  mp_copy.insert(mp_copy.end(), T3(9, "nine"));
+  mp_copy.insert(mp_copy.begin(), T3(1, "one"));
+  mp_copy.insert(mp_copy.end(), T3(9, "dup"));
+  printContainers(mp_copy);
+
+  mp_copy[7] = "seven";
+  mp_copy[1] = "ONE";
+  std::cout << "operator[] missing: [" << mp_copy[4] << "]" << std::endl;
+  mp_copy.find(9)->second = "NINE";
+  std::cout << "at 7: " << mp_copy.at(7) << std::endl;
+  try {
+    mp_copy.at(42);
+  } catch (std::out_of_range &e) {
+    std::cout << "at 42: out_of_range" << std::endl;
+  }
+  printContainers(mp_copy);
+
+  mp_copy.erase(mp_copy.find(1));
+  std::cout << "erase 7: " << mp_copy.erase(7) << std::endl;
+  std::cout << "erase 42: " << mp_copy.erase(42) << std::endl;
+  printContainers(mp_copy);
+  mp_copy.erase(mp_copy.equal_range(5).first, mp_copy.equal_range(5).second);
+  printContainers(mp_copy);
+
+  std::cout << "  == grow / rehash test ==" << std::endl;
+  {
+    TESTED_MAP big;
+    for (int i = 0; i < 1000; ++i) {
+      big[i * 3] = std::string(i % 7 + 1, 'a' + i % 26);
+    }
+    std::cout << "load ok: " << LOAD_OK(big) << std::endl;
+    int found = 0;
+    for (int i = 0; i < 3000; ++i) {
+      found += big.count(i);
+    }
+    std::cout << "found: " << found << std::endl;
+    for (int i = 0; i < 1000; i += 2) {
+      big.erase(i * 3);
+    }
+    REHASH(big, 0);
+    MAX_LOAD(big, 0.5f);
+    std::cout << "load ok: " << LOAD_OK(big) << std::endl;
+    found = 0;
+    for (int i = 0; i < 3000; ++i) {
+      found += big.count(i);
+    }
+    std::cout << "found: " << found << std::endl;
+    printContainers(big, false);
+    big.erase(big.begin(), big.end());
+    printContainers(big);
+  }
+
+  std::cout << "  == collision test ==" << std::endl;
+  {
+    typedef UNORDERED_MAP(T1, T2, collide_hash) collide_map;
+    collide_map col(lst.begin(), lst.end());
+    col[100] = "hundred";
+    col.erase(3);
+    col.erase(7);
+    col[3] = "three";
+    std::cout << "count 3 / 7: " << col.count(3) << col.count(7) << std::endl;
+    printContainers(col);
+  }
+
+  std::cout << "  == erase while iterating test ==" << std::endl;
+  {
+    TESTED_MAP mp;
+    for (int i = 0; i < 200; ++i) {
+      mp[i] = std::string(i % 5 + 1, 'a' + i % 26);
+    }
+    // 지우면 리턴된 iterator에서 계속 간다. 모든 element를 한 번씩 본다.
+    int visited = 0;
+    int erased = 0;
+    for (TESTED_MAP::iterator it = mp.begin(); it != mp.end();) {
+      ++visited;
+      if (it->first % 3 == 0 || it->first > 190) {
+        it = ERASE_AT(mp, it);
+        ++erased;
+      } else {
+        ++it;
+      }
+    }
+    std::cout << "visited: " << visited << ", erased: " << erased << std::endl;
+    int left = 0;
+    for (int i = 0; i < 200; ++i) {
+      left += mp.count(i);
+    }
+    std::cout << "count after erase: " << left << std::endl;
+    printContainers(mp, false);
+    for (TESTED_MAP::iterator it = mp.begin(); it != mp.end();) {
+      it = ERASE_AT(mp, it);
+    }
+    printContainers(mp);
+  }
+
+  std::cout << "  == swap / find / count test ==" << std::endl;
+  swap(mp_copy, mp_range);
+  printContainers(mp_copy);
+  printContainers(mp_range);
+  std::cout << "find 5: " << mp_copy.find(5)->second << std::endl;
+  std::cout << "find 42 is end: " << (mp_copy.find(42) == mp_copy.end())
+            << std::endl;
+  std::cout << "count 5: " << mp_copy.count(5) << std::endl;
+  std::cout << "count 20: " << mp_copy.count(20) << std::endl;
+  std::cout << "equal_range 42 is empty: "
+            << (mp_copy.equal_range(42).first ==
+                mp_copy.equal_range(42).second)
+            << std::endl;
+
+  std::cout << "  == hash test ==" << std::endl;
+  std::cout << "string: "
+            << HASH_EQ(std::string, std::string("hash"), std::string("hash"))
+            << std::endl;
+  std::cout << "double: " << HASH_EQ(double, 0.0, -0.0) << std::endl;
+  {
+    typedef UNORDERED_MAP(T2, int, TESTED_NAMESPACE::hash< T2 >) word_map;
+    word_map words;
+    words["apple"] = 1;
+    words["banana"] = 2;
+    ++words["apple"];
+    printContainers(words);
+  }
+
+  std::cout << "  == relational operators test ==" << std::endl;
+  TESTED_MAP lhs(mp_copy);
+  TESTED_MAP rhs(mp_copy);
+  std::cout << (lhs == rhs) << (lhs != rhs) << std::endl;
+  lhs[5] = "Hello";
+  std::cout << (lhs == rhs) << (lhs != rhs) << std::endl;
+  rhs.erase(1);
+  std::cout << (lhs == rhs) << (lhs != rhs) << std::endl;
+
+#if __cplusplus >= 201103L
+  std::cout << "  == move / emplace test (C++11) ==" << std::endl;
+  {
+    TESTED_MAP mp_src;
+    std::cout << "emplace: " << mp_src.emplace(3, "three").second << std::endl;
+    std::cout << "emplace dup: " << mp_src.emplace(3, "again").second
+              << std::endl;
+    mp_src.emplace_hint(mp_src.end(), 9, "nine");
+    mp_src.emplace(4, std::string(4, 'f'));
+    printContainers(mp_src);
+
+    TESTED_MAP mp_moved(std::move(mp_src));
+    std::cout << "moved-from size: " << mp_src.size() << std::endl;
+    TESTED_MAP mp_assigned;
+    mp_assigned[100] = "old";
+    mp_assigned = std::move(mp_moved);
+    printContainers(mp_assigned);
+  }
+#endif
+}
@@ -0,0 +1,227 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_set.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: hyunlee <hyunlee@student.42seoul.kr>       +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:00:00 by hyunlee           #+#    #+#             */
+/*   Updated: 2026/10/17 14:00:00 by hyunlee          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "unordered_set.hpp"
+
+#include <iostream>
+#include <list>
+#include <set>
+#include <string>
+#include <utility>
+
+#ifndef TESTED_NAMESPACE
+#define TESTED_NAMESPACE ft
+#endif
+
+// std::unordered_set은 C++11부터 있으므로 std::set의 출력과 비교한다.
+// 순회 순서가 다르므로 출력은 항상 정렬해서 한다.
+#define IS_STD_std 1
+#define IS_STD_ft 0
+#define CAT(a, b) a##b
+#define XCAT(a, b) CAT(a, b)
+
+#define T1 int
+
+#if XCAT(IS_STD_, TESTED_NAMESPACE)
+#define UNORDERED_SET(T, H) std::set< T >
+#define RESERVE(st, n)
+#define REHASH(st, n)
+#define LOAD_OK(st) true
+
+// C++98의 std::set::erase(iterator)는 아무것도 리턴하지 않는다.
+template < typename C >
+typename C::iterator erase_at(C &c, typename C::iterator it) {
+  typename C::iterator next = it;
+
+  ++next;
+  c.erase(it);
+  return (next);
+}
+#define ERASE_AT(c, it) erase_at(c, it)
+#else
+#define UNORDERED_SET(T, H) ft::unordered_set< T, H >
+#define RESERVE(st, n) st.reserve(n)
+#define REHASH(st, n) st.rehash(n)
+#define LOAD_OK(st) \
+  (st.load_factor() <= st.max_load_factor() && st.bucket_count() >= st.size())
+#define ERASE_AT(c, it) c.erase(it)
+#endif
+
+// 모든 key가 같은 bucket으로 가는 hash. (충돌 처리 확인용)
+struct collide_hash {
+  size_t operator()(const T1 &) const { return (42); }
+};
+
+#define TESTED_SET UNORDERED_SET(T1, TESTED_NAMESPACE::hash< T1 >)
+
+template < typename T_SET >
+void printContainers(T_SET const &st, bool print_content = true) {
+  std::cout << "size: " << st.size() << std::endl;
+  if (print_content) {
+    std::set< typename T_SET::value_type > sorted(st.begin(), st.end());
+    std::cout << "Content is:" << std::endl;
+    for (typename std::set< typename T_SET::value_type >::const_iterator it =
+             sorted.begin();
+         it != sorted.end(); ++it) {
+      std::cout << "- " << *it << std::endl;
+    }
+  }
+  std::cout << "###############################################" << std::endl;
+}
+
+int main() {
+  std::cout << "////////// TEST UNORDERED_SET //////////" << std::endl;
+
+  std::cout << "  == default / range / copy constructor test ==" << std::endl;
+  TESTED_SET st;
+  printContainers(st);
+
+  std::list< T1 > lst;
+  for (unsigned int i = 0; i < 10; ++i) {
+    lst.push_back((i * 7) % 10);
+  }
+  TESTED_SET st_range(lst.begin(), lst.end());
+  printContainers(st_range);
+
+  TESTED_SET st_copy(st_range);
+  printContainers(st_copy);
+
+  std::cout << "  == size / clear / empty test ==" << std::endl;
+  st_copy.clear();
+  printContainers(st_copy);
+  std::cout << "Is empty: " << (st_copy.empty() ? "OK" : "KO") << std::endl;
+
+  std::cout << "  == insert / erase test ==" << std::endl;
+  RESERVE(st_copy, 16);
+  std::cout << "insert 5: " << st_copy.insert(5).second << std::endl;
+  std::cout << "insert 5 again: " << st_copy.insert(5).second << std::endl;
+  st_copy.insert(st_copy.end(), 9);
+  st_copy.insert(st_copy.begin(), 1);
+  st_copy.insert(st_copy.end(), 3);
+  st_copy.insert(st_copy.begin(), 9);
+  printContainers(st_copy);
+
+  st_copy.erase(st_copy.find(1));
+  std::cout << "erase 9: " << st_copy.erase(9) << std::endl;
+  std::cout << "erase 42: " << st_copy.erase(42) << std::endl;
+  printContainers(st_copy);
+
+  std::cout << "  == grow / rehash test ==" << std::endl;
+  {
+    TESTED_SET big;
+    for (int i = 0; i < 1000; ++i) {
+      big.insert(i * 5);
+    }
+    std::cout << "load ok: " << LOAD_OK(big) << std::endl;
+    for (int i = 0; i < 1000; i += 3) {
+      big.erase(i * 5);
+    }
+    REHASH(big, 4096);
+    std::cout << "load ok: " << LOAD_OK(big) << std::endl;
+    int found = 0;
+    for (int i = 0; i < 5000; ++i) {
+      found += big.count(i);
+    }
+    std::cout << "found: " << found << std::endl;
+    printContainers(big, false);
+    big.erase(big.begin(), big.end());
+    printContainers(big);
+  }
+
+  std::cout << "  == collision test ==" << std::endl;
+  {
+    typedef UNORDERED_SET(T1, collide_hash) collide_set;
+    collide_set col(lst.begin(), lst.end());
+    col.insert(100);
+    col.erase(3);
+    col.erase(7);
+    col.insert(3);
+    std::cout << "count 3 / 7: " << col.count(3) << col.count(7) << std::endl;
+    printContainers(col);
+  }
+
+  std::cout << "  == erase while iterating test ==" << std::endl;
+  {
+    typedef UNORDERED_SET(T1, collide_hash) collide_set;
+    collide_set col;
+    for (int i = 0; i < 60; ++i) {
+      col.insert(i * 7);
+    }
+    // 지우면 리턴된 iterator에서 계속 간다. 모든 element를 한 번씩 본다.
+    int visited = 0;
+    int erased = 0;
+    for (collide_set::iterator it = col.begin(); it != col.end();) {
+      ++visited;
+      if (*it % 2 == 0 || *it > 400) {
+        it = ERASE_AT(col, it);
+        ++erased;
+      } else {
+        ++it;
+      }
+    }
+    std::cout << "visited: " << visited << ", erased: " << erased << std::endl;
+    int left = 0;
+    for (int i = 0; i < 60; ++i) {
+      left += col.count(i * 7);
+    }
+    std::cout << "count after erase: " << left << std::endl;
+    printContainers(col);
+    for (collide_set::iterator it = col.begin(); it != col.end();) {
+      it = ERASE_AT(col, it);
+    }
+    printContainers(col);
+  }
+
+  std::cout << "  == swap / find / count test ==" << std::endl;
+  swap(st_copy, st_range);
+  printContainers(st_copy);
+  printContainers(st_range);
+  std::cout << "find 5: " << *st_copy.find(5) << std::endl;
+  std::cout << "find 42 is end: " << (st_copy.find(42) == st_copy.end())
+            << std::endl;
+  std::cout << "count 5: " << st_copy.count(5) << std::endl;
+  std::cout << "count 20: " << st_copy.count(20) << std::endl;
+  std::cout << "equal_range 5: " << *st_copy.equal_range(5).first
+            << std::endl;
+
+  std::cout << "  == string key test ==" << std::endl;
+  {
+    typedef UNORDERED_SET(std::string, TESTED_NAMESPACE::hash< std::string >)
+        word_set;
+    word_set words;
+    words.insert("apple");
+    words.insert("banana");
+    std::cout << "insert apple again: " << words.insert("apple").second
+              << std::endl;
+    printContainers(words);
+  }
+
+  std::cout << "  == relational operators test ==" << std::endl;
+  TESTED_SET lhs(st_copy);
+  TESTED_SET rhs(st_copy);
+  std::cout << (lhs == rhs) << (lhs != rhs) << std::endl;
+  lhs.insert(-1);
+  std::cout << (lhs == rhs) << (lhs != rhs) << std::endl;
+
+#if __cplusplus >= 201103L
+  std::cout << "  == move / emplace test (C++11) ==" << std::endl;
+  {
+    TESTED_SET st_src;
+    std::cout << "emplace: " << st_src.emplace(3).second << std::endl;
+    std::cout << "emplace dup: " << st_src.emplace(3).second << std::endl;
+    st_src.emplace_hint(st_src.end(), 9);
+    TESTED_SET st_moved(std::move(st_src));
+    std::cout << "moved-from size: " << st_src.size() << std::endl;
+    printContainers(st_moved);
+  }
+#endif
+}
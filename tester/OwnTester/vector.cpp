@@ -10,10 +10,17 @@
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "counting_allocator.hpp"
+#include "pool_allocator.hpp"
 #include "vector.hpp"
 
 #include <iostream>
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #ifndef TESTED_NAMESPACE
@@ -21,10 +28,28 @@
 #endif
 
 #define TESTED_TYPE int
+
+// std::vector에는 Growth 인자가 없고 shrink_to_fit은 C++11부터 있다.
+// std에서는 기본 vector와 swap으로 줄이는 방법을 쓰고, growth 규칙은
+// 검사하지 않는다. (규칙 위반 수 0으로 출력)
+#define IS_STD_std 1
+#define IS_STD_ft 0
+#define CAT(a, b) a##b
+#define XCAT(a, b) CAT(a, b)
+
+#if XCAT(IS_STD_, TESTED_NAMESPACE)
+#define GROWTH_VECTOR(T, G) std::vector< T >
+#define SHRINK_TO_FIT(v, V) V(v).swap(v)
+#define GROWTH_RULE(rule) any_growth
+#else
+#define GROWTH_VECTOR(T, G) ft::vector< T, std::allocator< T >, G >
+#define SHRINK_TO_FIT(v, V) v.shrink_to_fit()
+#define GROWTH_RULE(rule) rule
+#endif
 #define T_SIZE_TYPE typename TESTED_NAMESPACE::vector< T >::size_type
 
-template < typename T >
-void printContainers(TESTED_NAMESPACE::vector< T > const &vct,
+template < typename T, typename Alloc >
+void printContainers(TESTED_NAMESPACE::vector< T, Alloc > const &vct,
                      bool print_content = true) {
   const T_SIZE_TYPE size = vct.size();
   const T_SIZE_TYPE capacity = vct.capacity();
@@ -33,8 +58,10 @@ void printContainers(TESTED_NAMESPACE::vector< T > const &vct,
   std::cout << "size: " << size << std::endl;
   std::cout << "capacity: " << isCapacityOk << std::endl;
   if (print_content) {
-    typename TESTED_NAMESPACE::vector< T >::const_iterator it = vct.begin();
-    typename TESTED_NAMESPACE::vector< T >::const_iterator ite = vct.end();
+    typename TESTED_NAMESPACE::vector< T, Alloc >::const_iterator it =
+        vct.begin();
+    typename TESTED_NAMESPACE::vector< T, Alloc >::const_iterator ite =
+        vct.end();
     std::cout << std::endl << "Content is:" << std::endl;
     for (; it != ite; ++it) {
       std::cout << "- " << *it << std::endl;
@@ -43,6 +70,192 @@ void printContainers(TESTED_NAMESPACE::vector< T > const &vct,
   std::cout << "###############################################" << std::endl;
 }
 
+// copy 생성자가 budget번째 copy에서, 대입 연산자가 assign_budget번째
+// 대입에서 예외를 던지는 type.
+// live는 살아있는 객체 수. (leak / 중복 destroy 확인용)
+struct thrower {
+  static int budget;
+  static int assign_budget;
+  static int live;
+  int val;
+
+  thrower(int v = 0) : val(v) { ++live; }
+  thrower(const thrower &ot) : val(ot.val) {
+    if (budget >= 0 && budget-- == 0) throw(std::runtime_error("copy"));
+    ++live;
+  }
+  thrower &operator=(const thrower &ot) {
+    if (assign_budget >= 0 && assign_budget-- == 0) {
+      throw(std::runtime_error("assign"));
+    }
+    this->val = ot.val;
+    return (*this);
+  }
+  ~thrower() { --live; }
+};
+
+int thrower::budget = -1;
+int thrower::assign_budget = -1;
+int thrower::live = 0;
+
+std::ostream &operator<<(std::ostream &os, const thrower &t) {
+  return (os << t.val);
+}
+
+// budget번째 copy에서 던지도록 하고 op를 실행한 뒤 vector 상태를 출력한다.
+template < typename Op >
+void throwTest(TESTED_NAMESPACE::vector< thrower > &v, int budget, Op op,
+               const char *name) {
+  const size_t prev_capacity = v.capacity();
+
+  thrower::budget = budget;
+  try {
+    op(v);
+    std::cout << name << ": no exception" << std::endl;
+  } catch (std::runtime_error &e) {
+    std::cout << name << ": caught " << e.what() << std::endl;
+    std::cout << "capacity unchanged: "
+              << (v.capacity() == prev_capacity ? "OK" : "KO") << std::endl;
+  }
+  thrower::budget = -1;
+  std::cout << "live objects == size: "
+            << (thrower::live == static_cast< int >(v.size()) ? "OK" : "KO")
+            << std::endl;
+  printContainers(v);
+}
+
+struct reserve_op {
+  size_t n;
+  void operator()(TESTED_NAMESPACE::vector< thrower > &v) const {
+    v.reserve(n);
+  }
+};
+
+struct resize_op {
+  size_t n;
+  void operator()(TESTED_NAMESPACE::vector< thrower > &v) const {
+    v.resize(n, thrower(7));
+  }
+};
+
+struct push_back_op {
+  void operator()(TESTED_NAMESPACE::vector< thrower > &v) const {
+    v.push_back(thrower(9));
+  }
+};
+
+struct copy_op {
+  void operator()(TESTED_NAMESPACE::vector< thrower > &v) const {
+    TESTED_NAMESPACE::vector< thrower > copy(v);
+  }
+};
+
+struct fill_insert_op {
+  size_t n;
+  void operator()(TESTED_NAMESPACE::vector< thrower > &v) const {
+    v.insert(v.begin() + 1, n, thrower(5));
+  }
+};
+
+struct range_insert_op {
+  const TESTED_NAMESPACE::vector< thrower > *src;
+  void operator()(TESTED_NAMESPACE::vector< thrower > &v) const {
+    v.insert(v.begin() + 1, src->begin(), src->end());
+  }
+};
+
+/**
+ * capacity가 충분한 vector에서 budget번째 대입에서 던지도록 하고 op를
+ * 실행한다. 대입하던 element의 값은 구현마다 다르므로 새로 만든
+ * element가 모두 정리됐는지만 본다. (others: vector 밖의 살아있는 객체 수)
+ */
+template < typename Op >
+void assignThrowTest(int budget, Op op, const char *name, int others) {
+  TESTED_NAMESPACE::vector< thrower > v;
+  v.reserve(16);
+  for (int i = 0; i < 6; ++i) {
+    v.push_back(thrower(i));
+  }
+  thrower::assign_budget = budget;
+  try {
+    op(v);
+    std::cout << name << ": no exception" << std::endl;
+  } catch (std::runtime_error &e) {
+    std::cout << name << ": caught " << e.what() << std::endl;
+  }
+  thrower::assign_budget = -1;
+  std::cout << "capacity unchanged: " << (v.capacity() == 16 ? "OK" : "KO")
+            << std::endl;
+  std::cout << "live objects == size: "
+            << (thrower::live == static_cast< int >(v.size()) + others ? "OK"
+                                                                        : "KO")
+            << std::endl;
+}
+
+/**
+ * capacity가 before로 꽉 찬 상태에서 push_back 했을 때 늘어난 capacity가
+ * 각 growth policy의 규칙에 맞는지.
+ */
+bool any_growth(size_t, size_t) { return (true); }
+
+bool double_growth(size_t before, size_t after) {
+  return (after == (before == 0 ? 1 : before * 2));
+}
+
+bool golden_growth(size_t before, size_t after) {
+  size_t len = before + before / 2;
+
+  return (after == (len < before + 1 ? before + 1 : len));
+}
+
+// page 크기 64 byte, 256 byte부터 1.5배. element는 int.
+typedef ft::growth_page_aligned< 64, 256 > small_page_growth;
+
+bool page_growth(size_t before, size_t after) {
+  size_t len = before * sizeof(int) < 256 ? (before == 0 ? 1 : before * 2)
+                                          : before + before / 2;
+
+  if (len * sizeof(int) < 64) return (after == len);
+  return (after >= len && after * sizeof(int) % 64 == 0 &&
+          (after - len) * sizeof(int) < 64);
+}
+
+/**
+ * 0 ~ n-1을 push_back 하면서 reallocation마다 rule을 확인하고, 끝나면
+ * element가 모두 제자리에 있는지, shrink_to_fit / reserve 후 capacity를
+ * 출력한다.
+ */
+template < typename V >
+void growthTest(V &v, int n, bool (*rule)(size_t, size_t)) {
+  int broken = 0;
+  int wrong = 0;
+
+  for (int i = 0; i < n; ++i) {
+    size_t before = v.capacity();
+    v.push_back(i);
+    if (v.capacity() != before && !rule(before, v.capacity())) ++broken;
+  }
+  for (int i = 0; i < n; ++i) {
+    if (v[i] != i) ++wrong;
+  }
+  std::cout << "size: " << v.size() << ", rule broken: " << broken
+            << ", wrong elements: " << wrong << std::endl;
+
+  v.erase(v.begin() + n / 2, v.end());
+  SHRINK_TO_FIT(v, V);
+  std::cout << "after shrink_to_fit: " << v.size() << " / " << v.capacity()
+            << std::endl;
+  v.reserve(v.size() + 5);
+  std::cout << "after reserve(size + 5): " << v.capacity() << std::endl;
+  v.reserve(3);
+  std::cout << "after reserve(3): " << v.capacity() << std::endl;
+  wrong = 0;
+  for (int i = 0; i < n / 2; ++i) {
+    if (v[i] != i) ++wrong;
+  }
+  std::cout << "wrong elements: " << wrong << std::endl;
+}
+
 int main() {
   std::cout << "////////// TEST VECTOR //////////" << std::endl;
 
@@ -211,6 +424,37 @@ int main() {
   printContainers(v_swapA);
   printContainers(v_swapB);
 
+  std::cout << "  == swap iterator validity test ==" << std::endl;
+  {
+    TESTED_NAMESPACE::vector< TESTED_TYPE > v_big(6);
+    TESTED_NAMESPACE::vector< TESTED_TYPE > v_small(2, 42);
+    TESTED_NAMESPACE::vector< TESTED_TYPE > v_empty;
+    for (unsigned int i = 0; i < v_big.size(); ++i) {
+      v_big[i] = i * 10;
+    }
+    TESTED_NAMESPACE::vector< TESTED_TYPE >::iterator it_big =
+        v_big.begin() + 2;
+    const TESTED_TYPE *data_small = &v_small[0];
+
+    v_big.swap(v_small);
+    std::cout << "member swap sizes: " << v_big.size() << " "
+              << v_small.size() << std::endl;
+    std::cout << "iterator follows elements: " << *it_big << " "
+              << (it_big - v_small.begin()) << std::endl;
+    std::cout << "no copy: " << (&v_big[0] == data_small) << std::endl;
+
+    TESTED_NAMESPACE::swap(v_small, v_empty);
+    std::cout << "swap with empty: " << v_small.empty() << " "
+              << v_empty.size() << std::endl;
+    for (; it_big != v_empty.end(); ++it_big) {
+      std::cout << *it_big << " ";
+    }
+    std::cout << std::endl;
+    v_small.push_back(1);
+    printContainers(v_small);
+    printContainers(v_empty);
+  }
+
   std::cout << "  == clear test ==" << std::endl;
   TESTED_NAMESPACE::vector< TESTED_TYPE > v_clear(7);
   for (unsigned int i = 0; i < v_clear.size(); ++i) {
@@ -253,5 +497,193 @@ int main() {
   std::cout << "operator >=" << std::endl;
   std::cout << ((v_lhs >= v_rhs) ? "OK" : "KO") << std::endl;
 
+  std::cout << "  == input iterator (istream_iterator) test ==" << std::endl;
+  {
+    // 한 번만 읽을 수 있는 iterator. 개수를 먼저 세면 내용이 사라진다.
+    std::istringstream in_ctor("1 2 3 4 5");
+    TESTED_NAMESPACE::vector< TESTED_TYPE > v_in(
+        (std::istream_iterator< TESTED_TYPE >(in_ctor)),
+        std::istream_iterator< TESTED_TYPE >());
+    printContainers(v_in);
+
+    std::istringstream in_assign("10 20 30");
+    v_in.assign(std::istream_iterator< TESTED_TYPE >(in_assign),
+                std::istream_iterator< TESTED_TYPE >());
+    printContainers(v_in);
+
+    std::istringstream in_insert("7 8 9 10 11 12 13");
+    v_in.insert(v_in.begin() + 1,
+                std::istream_iterator< TESTED_TYPE >(in_insert),
+                std::istream_iterator< TESTED_TYPE >());
+    printContainers(v_in);
+  }
+
+  std::cout << "  == string element insert / erase / assign test =="
+            << std::endl;
+  {
+    TESTED_NAMESPACE::vector< std::string > v_str;
+    std::list< std::string > lst;
+    for (unsigned int i = 0; i < 5; ++i) {
+      v_str.push_back(std::string(20, 'a' + i));
+      lst.push_back(std::string(i + 1, 'A' + i));
+    }
+    v_str.insert(v_str.begin() + 2, 2, "inserted twice");
+    v_str.insert(v_str.begin() + 1, lst.begin(), lst.end());
+    v_str.insert(v_str.begin() + 3, 0, "never");
+    v_str.insert(v_str.begin(), lst.end(), lst.end());
+    printContainers(v_str);
+    v_str.erase(v_str.begin() + 4);
+    v_str.erase(v_str.begin() + 1, v_str.begin() + 3);
+    v_str.erase(v_str.begin() + 2, v_str.begin() + 2);
+    printContainers(v_str);
+    v_str.assign(lst.begin(), lst.end());
+    printContainers(v_str);
+  }
+
+  std::cout << "  == throwing copy constructor test ==" << std::endl;
+  {
+    TESTED_NAMESPACE::vector< thrower > v_throw;
+    v_throw.reserve(6);
+    for (int i = 0; i < 6; ++i) {
+      v_throw.push_back(thrower(i));
+    }
+    reserve_op reserve_big = {100};
+    resize_op resize_big = {20};
+    push_back_op push = {};
+    copy_op copy = {};
+
+    // 옮기던 중(4번째 element)에 예외 -> vector는 그대로
+    throwTest(v_throw, 3, reserve_big, "reserve");
+    throwTest(v_throw, 0, reserve_big, "reserve");
+    throwTest(v_throw, 5, push, "push_back");
+    // 예외가 없으면 정상적으로 늘어난다.
+    throwTest(v_throw, -1, reserve_big, "reserve");
+    throwTest(v_throw, 3, resize_big, "resize");
+    // 복사 생성 중 예외 -> 만들던 element와 storage를 정리한다.
+    throwTest(v_throw, 2, copy, "copy");
+    throwTest(v_throw, 0, copy, "copy");
+  }
+  std::cout << "live objects after scope: " << thrower::live << std::endl;
+
+  std::cout << "  == throwing assignment insert test ==" << std::endl;
+  {
+    TESTED_NAMESPACE::vector< thrower > src_short(3, thrower(8));
+    TESTED_NAMESPACE::vector< thrower > src_long(7, thrower(9));
+    const int others = 10;
+    // 뒤쪽 element가 넣는 수보다 많은 경우와 적은 경우
+    fill_insert_op fill_short = {3};
+    fill_insert_op fill_long = {6};
+    range_insert_op range_short = {&src_short};
+    range_insert_op range_long = {&src_long};
+
+    assignThrowTest(0, fill_short, "fill insert", others);
+    assignThrowTest(3, fill_short, "fill insert", others);
+    assignThrowTest(2, fill_long, "fill insert", others);
+    assignThrowTest(0, range_short, "range insert", others);
+    assignThrowTest(3, range_short, "range insert", others);
+    assignThrowTest(2, range_long, "range insert", others);
+  }
+  std::cout << "live objects after scope: " << thrower::live << std::endl;
+
+  std::cout << "  == growth policy / shrink_to_fit test ==" << std::endl;
+  {
+    TESTED_NAMESPACE::vector< TESTED_TYPE > v_default;
+    growthTest(v_default, 100, double_growth);
+    GROWTH_VECTOR(TESTED_TYPE, ft::growth_golden) v_golden;
+    growthTest(v_golden, 100, GROWTH_RULE(golden_growth));
+    GROWTH_VECTOR(TESTED_TYPE, small_page_growth) v_page;
+    growthTest(v_page, 300, GROWTH_RULE(page_growth));
+
+    TESTED_NAMESPACE::vector< std::string > v_str(5, std::string(20, 's'));
+    v_str.reserve(50);
+    v_str[2] = "changed";
+    SHRINK_TO_FIT(v_str, TESTED_NAMESPACE::vector< std::string >);
+    std::cout << "string shrink_to_fit: " << v_str.capacity() << std::endl;
+    printContainers(v_str);
+  }
+
+  std::cout << "  == counting allocator test ==" << std::endl;
+  {
+    ft::alloc_stats stats;
+    {
+      TESTED_NAMESPACE::vector< int, ft::counting_allocator< int > > v_cnt(
+          (ft::counting_allocator< int >(stats)));
+      v_cnt.reserve(10);
+      std::cout << "reserve: " << stats.allocations << " allocation, "
+                << stats.bytes_in_use << " bytes" << std::endl;
+      stats.begin_ops();
+      for (int i = 0; i < 11; ++i) {
+        v_cnt.push_back(i);
+        stats.end_op();
+      }
+      std::cout << "push_back x" << stats.ops << ": " << stats.histogram[0]
+                << " without allocation, " << stats.histogram[1]
+                << " with one" << std::endl;
+      std::cout << "old buffer freed: " << stats.op_deallocations << std::endl;
+    }
+    std::cout << "allocations == deallocations: "
+              << (stats.allocations == stats.deallocations) << std::endl;
+    std::cout << "in use after scope: " << stats.bytes_in_use << std::endl;
+  }
+
+#if __cplusplus >= 201103L
+  std::cout << "  == move / emplace test (C++11) ==" << std::endl;
+  {
+    TESTED_NAMESPACE::vector< std::string > v_src;
+    std::string word(30, 'm');
+    v_src.push_back(std::move(word));
+    v_src.emplace_back(5, 'e');
+    v_src.emplace_back("emplaced");
+    for (int i = 0; i < 5; ++i) {
+      // 공간이 없을 때 자기 element로 emplace_back
+      v_src.emplace_back(v_src[0]);
+    }
+    printContainers(v_src);
+
+    TESTED_NAMESPACE::vector< std::string > v_moved(std::move(v_src));
+    std::cout << "moved-from size: " << v_src.size() << std::endl;
+    printContainers(v_moved);
+
+    TESTED_NAMESPACE::vector< std::string > v_assigned(3, "old");
+    v_assigned = std::move(v_moved);
+    std::cout << "moved-from size: " << v_moved.size() << std::endl;
+    printContainers(v_assigned);
+  }
+
+  std::cout << "  == move assignment allocator test (C++11) ==" << std::endl;
+  {
+    typedef ft::counting_allocator< int > count_alloc;
+    typedef TESTED_NAMESPACE::vector< int, count_alloc > count_vector;
+    ft::alloc_stats stats_a;
+    ft::alloc_stats stats_b;
+    {
+      count_vector v_b(3, 2, (count_alloc(stats_b)));
+      {
+        count_vector v_a(5, 1, (count_alloc(stats_a)));
+        v_b = std::move(v_a);
+      }
+      v_b.push_back(3);
+      v_b.shrink_to_fit();
+      printContainers(v_b);
+    }
+    // buffer는 자기를 할당한 allocator로 반환되어야 한다.
+    std::cout << "in use after scope: " << stats_a.bytes_in_use << ", "
+              << stats_b.bytes_in_use << std::endl;
+
+    // 다른 pool에서 받은 buffer. pool_a가 먼저 사라져도 v_b는 쓸 수 있다.
+    typedef TESTED_NAMESPACE::vector< int, ft::pool_allocator< int > >
+        pool_vector;
+    pool_vector p_b(1, 8);
+    {
+      pool_vector p_a(1, 7);
+      p_b = std::move(p_a);
+    }
+    p_b.shrink_to_fit();
+    p_b.push_back(9);
+    p_b.shrink_to_fit();
+    printContainers(p_b);
+  }
+#endif
+
   // system("leaks vector");
 }